@@ -196,6 +196,17 @@
   []
 []
 
+[Postprocessors]
+  [stable_dt]
+    type = BVFVStableTimeStep
+    transport = 'saturation'
+    pressure = p
+    cfl = 0.9
+    execute_on = 'INITIAL TIMESTEP_END'
+    outputs = none
+  []
+[]
+
 # [Preconditioning]
 #   [hypre]
 #     type = SMP
@@ -241,7 +252,11 @@
   scheme = 'bdf2'
   start_time = 0
   end_time = 1.0
-  num_steps = 100
+  [TimeStepper]
+    type = BVCFLTimeStepper
+    stable_dt = stable_dt
+    dt = 1.0e-03
+  []
   timestep_tolerance = 1.0e-05
   automatic_scaling = true
   residual_and_jacobian_together = true
@@ -256,5 +271,7 @@
     type = CSV
     sync_only = true
     sync_times = '0.25 0.5 0.75'
+    # Maps the time step numbers of the line samples to the (adaptive) times
+    time_data = true
   []
 []
@@ -9,15 +9,13 @@ def analyticalSolution(v):
 
 def numericalSolution(t):
   filebase = "buckley-leverett_csv_line_sw_"
-  if t==0.25:
-    filename = filebase + "0025.csv"
-  elif t==0.5:
-    filename = filebase + "0050.csv"
-  elif t==0.75:
-    filename = filebase + "0075.csv"
-  else:
-    print("Unknown filename!")
-    exit
+  # The time steps are adaptive: find the time step of the output at time t
+  data = np.genfromtxt(filebase + "time.csv", delimiter=',', names=True)
+  i = np.argmin(np.abs(data["time"] - t))
+  if abs(data["time"][i] - t) > 1.0e-06:
+    print("No output at time " + str(t) + "!")
+    exit()
+  filename = filebase + "%04d.csv" % int(data["timestep"][i])
 
   x, s = np.loadtxt(filename, delimiter=',', skiprows=1, usecols=[2,1], unpack=True)
 
@@ -139,6 +139,17 @@
   []
 []
 
+[Postprocessors]
+  [stable_dt]
+    type = BVFVStableTimeStep
+    transport = 'solute'
+    pressure = pf
+    cfl = 0.9
+    execute_on = 'INITIAL TIMESTEP_END'
+    outputs = none
+  []
+[]
+
 [Preconditioning]
   [hypre]
     type = SMP
@@ -157,7 +168,11 @@
   residual_and_jacobian_together = true
   start_time = 0
   end_time = 0.6
-  num_steps = 600
+  [TimeStepper]
+    type = BVCFLTimeStepper
+    stable_dt = stable_dt
+    dt = 1.0e-03
+  []
 []
 
 [Outputs]
@@ -169,5 +184,7 @@
     type = CSV
     sync_only = true
     sync_times = '0.2 0.4 0.6'
+    # Maps the time step numbers of the line samples to the (adaptive) times
+    time_data = true
   []
 []
@@ -13,15 +13,13 @@ def analyticalSolution(x, t):
 
 def numericalSolution(t):
   filebase = "outputs/advection-diffusion_line_c_"
-  if t==0.2:
-    filename = filebase + "0200.csv"
-  elif t==0.4:
-    filename = filebase + "0400.csv"
-  elif t==0.6:
-    filename = filebase + "0600.csv"
-  else:
-    print("Unknown filename!")
-    exit
+  # The time steps are adaptive: find the time step of the output at time t
+  data = np.genfromtxt(filebase + "time.csv", delimiter=',', names=True)
+  i = np.argmin(np.abs(data["time"] - t))
+  if abs(data["time"][i] - t) > 1.0e-06:
+    print("No output at time " + str(t) + "!")
+    exit()
+  filename = filebase + "%04d.csv" % int(data["timestep"][i])
 
   x, c = np.loadtxt(filename, delimiter=',', skiprows=1, usecols=[2, 0], unpack=True)
 
@@ -0,0 +1,328 @@
+import os, sys, csv, json, shutil, argparse, subprocess, tempfile
+import numpy as np
+from multiprocessing import Pool
+from scipy.optimize import least_squares, minimize
+
+# Calibration of creep model parameters against laboratory creep curves
+#
+# Each laboratory curve is reproduced by a homogeneous triaxial creep test integrated at a single
+# quadrature point (one element with a constant quadrature rule, confining pressure P and axial
+# stress Q(t), compression positive). The model axial strain (compression positive) is compared to
+# the measured one at the measured times.
+# The integration is left to BEAVER so that the calibrated parameters are those of the C++ models
+# without re-implementing them here. With a single point, the cost of a run is dominated by the
+# start of the process, hence all the runs of an evaluation (curves and finite difference
+# perturbations of the Jacobian) are executed in parallel.
+#
+# Usage: python calibration.py burger_calibration.json --jobs 4 --method lm
+#        python calibration.py burger_calibration.json --check parameters.json --tolerance 0.05
+# The executable is taken from the BEAVER_EXEC environment variable or defaults to beaver-opt in
+# the root directory of the application.
+
+_default_exec = os.path.join(os.path.dirname(os.path.abspath(__file__)), "../../../beaver-opt")
+
+def beaverExecutable():
+  return os.environ.get("BEAVER_EXEC", _default_exec)
+
+def readCurve(filename):
+  t, e = np.loadtxt(filename, delimiter=',', skiprows=1, usecols=[0, 1], unpack=True)
+
+  return (t, e)
+
+def inputFile(config, params, curve):
+  P = curve["confining_pressure"]
+  steps = curve["axial_stress"]
+  x = " ".join(str(s[0]) for s in steps)
+  y = " ".join(str(s[1]) for s in steps)
+
+  model = "\n".join("    %s = %.17g" % (k, v) for k, v in params.items())
+  temperature_var = ""
+  if "temperature" in curve:
+    model += "\n    temperature = temp"
+    temperature_var = ("  [temp]\n    order = CONSTANT\n    family = MONOMIAL\n"
+                       "    initial_condition = %.17g\n  []\n" % curve["temperature"])
+  elasticity = "\n".join("    %s = %.17g" % (k, v) for k, v in config["elasticity"].items())
+
+  return f"""[Mesh]
+  type = GeneratedMesh
+  dim = 3
+[]
+
+[Variables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+[]
+
+[Kernels]
+  [stress_x]
+    type = BVStressDivergence
+    component = x
+    variable = disp_x
+  []
+  [stress_y]
+    type = BVStressDivergence
+    component = y
+    variable = disp_y
+  []
+  [stress_z]
+    type = BVStressDivergence
+    component = z
+    variable = disp_z
+  []
+[]
+
+[AuxVariables]
+{temperature_var}  [strain_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [strain_yy_aux]
+    type = BVStrainComponentAux
+    variable = strain_yy
+    index_i = y
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Functions]
+  [axial_stress]
+    type = PiecewiseConstant
+    direction = right
+    x = '{x}'
+    y = '{y}'
+  []
+[]
+
+[BCs]
+  [no_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'left'
+    value = 0.0
+  []
+  [no_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom'
+    value = 0.0
+  []
+  [no_z]
+    type = DirichletBC
+    variable = disp_z
+    boundary = 'back'
+    value = 0.0
+  []
+  [BVPressure]
+    [pressure_right]
+      boundary = 'right'
+      displacement_vars = 'disp_x disp_y disp_z'
+      value = {P}
+    []
+    [pressure_front]
+      boundary = 'front'
+      displacement_vars = 'disp_x disp_y disp_z'
+      value = {P}
+    []
+    [pressure_top]
+      boundary = 'top'
+      displacement_vars = 'disp_x disp_y disp_z'
+      function = axial_stress
+    []
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = BVMechanicalMaterial
+    displacements = 'disp_x disp_y disp_z'
+{elasticity}
+    initial_stress = '-{P} -{P} -{P}'
+    inelastic_models = 'viscoelastic'
+  []
+  [viscoelastic]
+    type = {config["model"]}
+{model}
+  []
+[]
+
+[Postprocessors]
+  [strain_yy]
+    type = ElementAverageValue
+    variable = strain_yy
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0.0
+  end_time = {curve["end_time"]}
+  dt = {curve["dt"]}
+  nl_abs_tol = 1.0e-12
+  timestep_tolerance = 1.0e-10
+  [Quadrature]
+    type = GAUSS
+    order = CONSTANT
+  []
+[]
+
+[Outputs]
+  csv = true
+[]
+"""
+
+def runCurve(args):
+  # Runs a single element test and returns the model axial strain at the measured times
+  config, params, curve, t_data = args
+
+  workdir = tempfile.mkdtemp(prefix="beaver_calibration_")
+  try:
+    with open(os.path.join(workdir, "creep.i"), "w") as f:
+      f.write(inputFile(config, params, curve))
+    run = subprocess.run([beaverExecutable(), "-i", "creep.i", "--no-color"], cwd=workdir,
+                         stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, text=True)
+    if run.returncode != 0:
+      # Failed evaluations are penalized instead of stopping the calibration
+      return np.full(t_data.shape, np.nan)
+    t, e = np.loadtxt(os.path.join(workdir, "creep_out.csv"), delimiter=',', skiprows=1,
+                      usecols=[0, 1], unpack=True)
+  finally:
+    shutil.rmtree(workdir, ignore_errors=True)
+
+  return np.interp(t_data, t, -e)
+
+class Calibration:
+  def __init__(self, config, pool):
+    self.config = config
+    self.pool = pool
+    self.names = list(config["parameters"].keys())
+    self.log = [config["parameters"][p].get("log", True) for p in self.names]
+    self.fixed = config.get("fixed", {})
+    self.data = [readCurve(c["file"]) for c in config["curves"]]
+    # Residuals are scaled by the maximum measured strain of each curve
+    self.scales = [np.max(np.abs(e)) for _, e in self.data]
+    self.fd_step = config.get("finite_difference_step", 1.0e-06)
+    self.evaluations = 0
+
+  def initialGuess(self):
+    return np.array([self.toOptimizer(self.config["parameters"][p]["initial"], i)
+                     for i, p in enumerate(self.names)])
+
+  def toOptimizer(self, v, i):
+    return np.log10(v) if self.log[i] else v
+
+  def fromOptimizer(self, x):
+    params = dict(self.fixed)
+    for i, p in enumerate(self.names):
+      params[p] = 10.0**x[i] if self.log[i] else x[i]
+    return params
+
+  def residualsFromStrains(self, strains):
+    res = [(e_model - e) / s for e_model, (_, e), s in zip(strains, self.data, self.scales)]
+    res = np.concatenate(res)
+    # Large but finite residuals for failed evaluations
+    return np.nan_to_num(res, nan=1.0e+03)
+
+  def evaluate(self, xs):
+    # Runs all the curves of all parameter sets in a single parallel batch
+    jobs = [(self.config, self.fromOptimizer(x), c, t)
+            for x in xs for c, (t, _) in zip(self.config["curves"], self.data)]
+    strains = self.pool.map(runCurve, jobs)
+    self.evaluations += len(jobs)
+    n = len(self.config["curves"])
+    return [self.residualsFromStrains(strains[i * n:(i + 1) * n]) for i in range(len(xs))]
+
+  def residuals(self, x):
+    return self.evaluate([x])[0]
+
+  def jacobian(self, x):
+    # Forward finite differences evaluated in parallel
+    h = self.fd_step * np.maximum(np.abs(x), 1.0)
+    xs = [x] + [x + h[i] * np.eye(len(x))[i] for i in range(len(x))]
+    res = self.evaluate(xs)
+    return np.array([(res[i + 1] - res[0]) / h[i] for i in range(len(x))]).T
+
+  def cost(self, x):
+    return 0.5 * np.sum(self.residuals(x)**2)
+
+def plotCalibration(calibration, params, filename):
+  import matplotlib.pyplot as plt
+  plt.style.use('../../publication.mplstyle')
+
+  jobs = [(calibration.config, params, c, t)
+          for c, (t, _) in zip(calibration.config["curves"], calibration.data)]
+  strains = calibration.pool.map(runCurve, jobs)
+
+  fig, ax = plt.subplots()
+  for (t, e), e_model, c in zip(calibration.data, strains, calibration.config["curves"]):
+    p = ax.scatter(t, e, marker="o", linewidths=0.0, label=os.path.basename(c["file"]))
+    ax.plot(t, e_model, color=p.get_facecolor()[0])
+  ax.set_xlabel("Time")
+  ax.set_ylabel("Axial strain")
+  ax.legend(loc="best")
+  fig.savefig(filename, format="PNG", dpi=300, bbox_inches="tight")
+
+if __name__ == "__main__":
+
+  parser = argparse.ArgumentParser(description="Calibrate creep model parameters against laboratory curves.")
+  parser.add_argument("config", help="The JSON calibration file.")
+  parser.add_argument("--jobs", type=int, default=os.cpu_count(), help="The number of parallel runs.")
+  parser.add_argument("--method", choices=["lm", "nelder-mead"], default="lm",
+                      help="Levenberg-Marquardt least squares or derivative-free Nelder-Mead.")
+  parser.add_argument("--plot", help="Save a comparison plot of the calibrated curves.")
+  parser.add_argument("--check", help="Only evaluate the parameters of a JSON file and fail if the "
+                      "RMS of the scaled residuals is larger than the tolerance.")
+  parser.add_argument("--tolerance", type=float, default=0.05,
+                      help="The tolerance of --check.")
+  args = parser.parse_args()
+
+  with open(args.config) as f:
+    config = json.load(f)
+  # Curve files are relative to the calibration file
+  root = os.path.dirname(os.path.abspath(args.config))
+  for c in config["curves"]:
+    c["file"] = os.path.join(root, c["file"])
+
+  with Pool(args.jobs) as pool:
+    calibration = Calibration(config, pool)
+
+    if args.check:
+      with open(args.check) as f:
+        params = json.load(f)
+      x = np.array([calibration.toOptimizer(params[p], i) for i, p in enumerate(calibration.names)])
+      rms = np.sqrt(np.mean(calibration.residuals(x)**2))
+      print("RMS of the scaled residuals: %g" % rms)
+      sys.exit(0 if rms <= args.tolerance else 1)
+
+    x0 = calibration.initialGuess()
+
+    if args.method == "lm":
+      sol = least_squares(calibration.residuals, x0, jac=calibration.jacobian, method="lm",
+                          xtol=1.0e-10, ftol=1.0e-10)
+      x = sol.x
+      cost = sol.cost
+    else:
+      sol = minimize(calibration.cost, x0, method="Nelder-Mead",
+                     options={"xatol": 1.0e-06, "fatol": 1.0e-12, "maxfev": 2000})
+      x = sol.x
+      cost = sol.fun
+
+    params = calibration.fromOptimizer(x)
+    print("Calibrated parameters (cost = %g, %d runs):" % (cost, calibration.evaluations))
+    for p in calibration.names:
+      print("  %s = %g" % (p, params[p]))
+
+    output = os.path.splitext(args.config)[0] + "_calibrated.json"
+    with open(output, "w") as f:
+      json.dump({"model": config["model"], "parameters": params, "cost": cost}, f, indent=2)
+
+    if args.plot:
+      plotCalibration(calibration, params, args.plot)
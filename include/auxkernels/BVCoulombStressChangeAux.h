@@ -0,0 +1,41 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "BVFaultStressAuxBase.h"
+
+class Function;
+
+class BVCoulombStressChangeAux : public BVFaultStressAuxBase
+{
+public:
+  static InputParameters validParams();
+  BVCoulombStressChangeAux(const InputParameters & parameters);
+
+protected:
+  virtual Real computeValue() override;
+  virtual Real coulombStressChange(const RealVectorValue & normal,
+                                   const RankTwoTensor & stress,
+                                   const RankTwoTensor & ref_stress,
+                                   const Real & dp);
+  virtual RankTwoTensor referenceStress();
+
+  const Real _f;
+  const VariableValue & _pf;
+  const ADMaterialProperty<Real> * _biot;
+  const Function & _pf_ref;
+  std::vector<const Function *> _ref_stress;
+  std::vector<RealVectorValue> _fault_normals;
+  const MooseEnum _output;
+};
@@ -19,7 +19,7 @@ class BVFaultStressAuxBase : public BVStressAuxBase
 {
 public:
   static InputParameters validParams();
-  BVFaultStressAuxBase(const InputParameters & parameters);
+  BVFaultStressAuxBase(const InputParameters & parameters, const bool requires_normal = true);
 
 protected:
   virtual RealVectorValue computeNormalVector();
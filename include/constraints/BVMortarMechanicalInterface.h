@@ -0,0 +1,58 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ADMortarConstraint.h"
+
+class BVMortarMechanicalInterface : public ADMortarConstraint
+{
+public:
+  static InputParameters validParams();
+  BVMortarMechanicalInterface(const InputParameters & parameters);
+  virtual void timestepSetup() override;
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+
+protected:
+  virtual ADReal computeQpResidual(Moose::MortarType type) override;
+  virtual const ADRealVectorValue & computeQpTraction();
+
+  typedef std::pair<dof_id_type, dof_id_type> SegmentKey;
+  typedef std::tuple<dof_id_type, dof_id_type, unsigned int> QpKey;
+
+  const unsigned int _component;
+  const unsigned int _ndisp;
+  std::vector<const ADVariableValue *> _disp_secondary;
+  std::vector<const ADVariableValue *> _disp_primary;
+  std::vector<const VariableValue *> _disp_secondary_old;
+  std::vector<const VariableValue *> _disp_primary_old;
+
+  // Elastic stiffness and friction parameters
+  const RankTwoTensor _K;
+  const bool _has_friction;
+  const Real _f;
+
+  // Local traction history at the quadrature points of each mortar segment (pair of
+  // lower-dimensional elements)
+  std::map<SegmentKey, std::vector<RealVectorValue>> & _traction;
+  std::map<SegmentKey, std::vector<RealVectorValue>> & _traction_old;
+
+  // Traction of the last evaluated quadrature point
+  QpKey _current_key;
+  bool _current_valid;
+  ADRealVectorValue _traction_global;
+
+  // Last time step whose tractions were accepted as history
+  int & _committed_t_step;
+};
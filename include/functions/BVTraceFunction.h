@@ -0,0 +1,30 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "Function.h"
+#include "LinearInterpolation.h"
+
+class BVTraceFunction : public Function
+{
+public:
+  static InputParameters validParams();
+  BVTraceFunction(const InputParameters & parameters);
+
+  using Function::value;
+  virtual Real value(Real t, const Point & p) const override;
+
+protected:
+  std::unique_ptr<LinearInterpolation> _temperature;
+};
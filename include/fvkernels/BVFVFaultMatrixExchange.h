@@ -0,0 +1,40 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "FVElementalKernel.h"
+#include "MeshChangedInterface.h"
+
+class BVFVFaultMatrixExchange : public FVElementalKernel, public MeshChangedInterface
+{
+public:
+  static InputParameters validParams();
+  BVFVFaultMatrixExchange(const InputParameters & parameters);
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+protected:
+  virtual ADReal computeQpResidual() override;
+  void buildFaultMatrixMaps();
+
+  const Moose::Functor<ADReal> & _pf_fault;
+  const Moose::Functor<ADReal> & _pf_matrix;
+  const Real _exchange_coeff;
+  const bool _on_fault;
+
+  // Matrix elements on both sides of each fault element
+  std::unordered_map<dof_id_type, std::vector<const Elem *>> _fault_to_matrix;
+  // Fault elements (and their area) adjacent to each matrix element
+  std::unordered_map<dof_id_type, std::vector<std::pair<const Elem *, Real>>> _matrix_to_fault;
+};
@@ -14,20 +14,48 @@
 #pragma once
 
 #include "FVFluxKernel.h"
+#include "MeshChangedInterface.h"
 
-class BVFVFluxKernelBase : public FVFluxKernel
+class BVFVFluxKernelBase : public FVFluxKernel, public MeshChangedInterface
 {
 public:
   static InputParameters validParams();
   BVFVFluxKernelBase(const InputParameters & params);
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
 
 protected:
   virtual ADReal transmissibility(const ADReal & coeff_elem, const ADReal & coeff_neighbor) const;
   virtual ADRealVectorValue diffusiveFlux(const ADReal & mobility_elem,
                                           const ADReal & mobility_neighbor,
                                           const MooseVariableFV<Real> & fv_var) const;
+  virtual ADRealVectorValue diffusiveFlux(const ADReal & mobility_elem,
+                                          const ADReal & mobility_neighbor,
+                                          const MooseVariableFV<Real> & fv_var,
+                                          const Moose::StateArg & state) const;
+  virtual ADRealVectorValue twoPointFlux(const ADReal & coeff,
+                                         const MooseVariableFV<Real> & fv_var,
+                                         const Moose::StateArg & state) const;
+  Real geometricTransmissibility() const;
+  void buildGeometricTransmissibilities();
   virtual ADRealVectorValue advectiveFluxVariable(const ADRealVectorValue & vel) const;
   virtual ADRealVectorValue advectiveFluxMaterial(const ADReal & qty_elem,
                                                   const ADReal & qty_neighbor,
                                                   const ADRealVectorValue & vel) const;
+  virtual ADRealVectorValue advectiveFluxMaterial(const ADReal & qty_elem,
+                                                  const ADReal & qty_neighbor,
+                                                  const ADRealVectorValue & vel,
+                                                  const Moose::StateArg & state) const;
+  ADReal limitedFaceValue(const ADReal & qty_elem,
+                          const ADReal & qty_neighbor,
+                          const ADRealVectorValue & vel,
+                          const Moose::StateArg & state) const;
+  ADReal limiter(const ADReal & r) const;
+
+  // Two-point flux approximation on orthogonal meshes
+  const bool _two_point_flux;
+  std::vector<Real> _geometric_transmissibility;
+
+  // Slope limiter of the second-order advective fluxes
+  const enum class LimiterEnum { UPWIND, MINMOD, VANLEER, SUPERBEE } _limiter;
 };
@@ -15,6 +15,8 @@
 
 #include "BVFVFluxKernelBase.h"
 
+class BVFVLaggedMobility;
+
 class BVFVMultiPhasePressureDarcy : public BVFVFluxKernelBase
 {
 public:
@@ -26,4 +28,5 @@ protected:
 
   const ADMaterialProperty<Real> & _lambda;
   const ADMaterialProperty<Real> & _lambda_neighbor;
+  const BVFVLaggedMobility * const _lagged_mobility;
 };
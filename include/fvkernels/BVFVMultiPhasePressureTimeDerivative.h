@@ -25,6 +25,7 @@ protected:
   virtual ADReal computeQpResidual() override;
 
   const ADVariableValue & _sw;
+  const bool _has_sn;
   const ADVariableValue & _sn;
   const ADMaterialProperty<Real> & _porosity;
   const ADMaterialProperty<Real> & _density_w;
@@ -15,6 +15,8 @@
 
 #include "BVFVFluxKernelBase.h"
 
+class BVFVLaggedMobility;
+
 class BVFVMultiPhaseSaturationDarcy : public BVFVFluxKernelBase
 {
 public:
@@ -25,6 +27,7 @@ protected:
   virtual ADReal computeQpResidual() override;
 
   const enum class PhaseEnum { WETTING, NON_WETTING, SINGLE } _phase;
+  const enum class TransportEnum { COUPLED, IMPLICIT, EXPLICIT } _transport;
 
   const MooseVariableFV<Real> * _p_var;
   const ADMaterialProperty<Real> & _lambda;
@@ -35,4 +38,11 @@ protected:
   const ADMaterialProperty<Real> & _f_n_neighbor;
   const ADMaterialProperty<Real> & _D;
   const ADMaterialProperty<Real> & _D_neighbor;
+
+  // Lagged properties for the sequential transport schemes
+  const BVFVLaggedMobility * const _lagged_mobility;
+  const MaterialProperty<Real> * _f_old;
+  const MaterialProperty<Real> * _f_neighbor_old;
+  const MaterialProperty<Real> * _D_old;
+  const MaterialProperty<Real> * _D_neighbor_old;
 };
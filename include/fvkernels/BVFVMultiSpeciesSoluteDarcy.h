@@ -0,0 +1,42 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "BVFVFluxKernelBase.h"
+
+class BVFVDarcyFluxCache;
+
+class BVFVMultiSpeciesSoluteDarcy : public BVFVFluxKernelBase
+{
+public:
+  static InputParameters validParams();
+  BVFVMultiSpeciesSoluteDarcy(const InputParameters & parameters);
+  virtual void residualSetup() override;
+  virtual void jacobianSetup() override;
+
+protected:
+  virtual ADReal computeQpResidual() override;
+  ADRealVectorValue darcyVelocity() const;
+
+  const MooseVariableFV<Real> * _p_var;
+  const unsigned int _species;
+  const BVFVDarcyFluxCache * _flux_cache;
+  const ADMaterialProperty<Real> & _lambda;
+  const ADMaterialProperty<Real> & _lambda_neighbor;
+  const ADMaterialProperty<std::vector<Real>> & _lambda_c;
+  const ADMaterialProperty<std::vector<Real>> & _lambda_c_neighbor;
+
+  // Whether the species index was checked against the number of species
+  bool _species_checked;
+};
@@ -0,0 +1,29 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ADTimeKernelValue.h"
+
+class BVInertia : public ADTimeKernelValue
+{
+public:
+  static InputParameters validParams();
+  BVInertia(const InputParameters & parameters);
+
+protected:
+  virtual ADReal precomputeQpResidual() override;
+
+  const ADVariableValue & _u_dotdot;
+  const ADMaterialProperty<Real> & _rho;
+};
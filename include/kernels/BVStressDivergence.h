@@ -27,9 +27,9 @@ protected:
   const bool _coupled_pf;
   const ADVariableValue & _pf;
   const unsigned int _component;
-  //   const Real _rho;
-  //   const RealVectorValue _gravity;
+  const RealVectorValue _gravity;
 
   const ADMaterialProperty<RankTwoTensor> & _stress;
+  const ADMaterialProperty<Real> & _rho;
   const ADMaterialProperty<Real> * _biot;
 };
\ No newline at end of file
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "BVTwoCreepUpdateBase.h"
+#include "BVPowerExponent.h"
 
 class BVBlancoMartinModelUpdate : public BVTwoCreepUpdateBase
 {
@@ -56,6 +57,21 @@ protected:
   const Real _m;
   const Real _n;
 
+  // Precomputed exponents
+  const BVPowerExponent _pow_beta1;
+  const BVPowerExponent _pow_beta2;
+  const BVPowerExponent _pow_beta1_m1;
+  const BVPowerExponent _pow_beta2_m1;
+  const BVPowerExponent _pow_inv_alpha;
+  const BVPowerExponent _pow_inv_alpha_m1;
+  const BVPowerExponent _pow_1m_inv_alpha;
+  const BVPowerExponent _pow_m_inv_alpha;
+  const BVPowerExponent _pow_n1;
+  const BVPowerExponent _pow_n;
+  const BVPowerExponent _pow_m;
+  const BVPowerExponent _pow_n_m1;
+  const BVPowerExponent _pow_m_m1;
+
   // Internal variable for Lemaitre and Munson-Dawson creep strain
   ADMaterialProperty<Real> & _eqv_creep_strain_L;
   const MaterialProperty<Real> & _eqv_creep_strain_L_old;
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "BVCapillaryPressureBase.h"
+#include "BVPowerExponent.h"
 
 class BVCapillaryPressurePowerLaw : public BVCapillaryPressureBase
 {
@@ -26,4 +27,6 @@ protected:
 
   const Real _n;
   const Real _pce;
+  const BVPowerExponent _pow_pc;
+  const BVPowerExponent _pow_dpc;
 };
\ No newline at end of file
@@ -0,0 +1,29 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "BVCapillaryPressureBase.h"
+#include "BVMonotoneSpline.h"
+
+class BVCapillaryPressureTable : public BVCapillaryPressureBase
+{
+public:
+  static InputParameters validParams();
+  BVCapillaryPressureTable(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  BVMonotoneSpline _pc_table;
+};
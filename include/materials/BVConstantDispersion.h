@@ -25,4 +25,5 @@ protected:
   virtual void computeQpProperties() override;
 
   const Real _dispersion0;
+  const std::vector<Real> _species_dispersion0;
 };
\ No newline at end of file
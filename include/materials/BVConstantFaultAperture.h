@@ -0,0 +1,29 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "Material.h"
+
+class BVConstantFaultAperture : public Material
+{
+public:
+  static InputParameters validParams();
+  BVConstantFaultAperture(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  const Real _aperture0;
+  ADMaterialProperty<Real> & _aperture;
+};
@@ -24,6 +24,7 @@ public:
 protected:
   virtual ADReal frictionalStrength(const ADReal & delta_dot) override;
   virtual ADReal frictionalStrengthDeriv(const ADReal & delta_dot) override;
+  virtual bool linearStrength() const override { return true; }
 
   // Friction parameters
   const Real _f;
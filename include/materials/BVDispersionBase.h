@@ -25,4 +25,6 @@ protected:
   virtual void computeQpProperties() = 0;
 
   ADMaterialProperty<Real> & _dispersion;
+  // Dispersion of each species for multi-species transport
+  ADMaterialProperty<std::vector<Real>> & _species_dispersion;
 };
\ No newline at end of file
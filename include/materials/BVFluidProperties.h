@@ -26,6 +26,20 @@ public:
 protected:
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
+  virtual void computeQpFluidProperties();
+
+  // Equation of state evaluation at a given pressure and temperature
+  struct FluidState
+  {
+    Real p;
+    Real T;
+    Real rho;
+    Real drho_dp;
+    Real drho_dT;
+    Real mu;
+    Real dmu_dp;
+    Real dmu_dT;
+  };
 
   const ADVariableValue & _pf;
   const ADVariableValue & _temp;
@@ -37,4 +51,8 @@ protected:
 
   ADMaterialProperty<Real> & _density;
   ADMaterialProperty<Real> & _viscosity;
+
+  // Memo of the last evaluation at each quadrature point (keyed by element and side)
+  const bool _memoize;
+  std::map<std::pair<dof_id_type, unsigned int>, std::vector<FluidState>> _memo;
 };
\ No newline at end of file
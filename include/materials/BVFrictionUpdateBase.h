@@ -21,13 +21,17 @@ public:
   static InputParameters validParams();
   BVFrictionUpdateBase(const InputParameters & parameters);
   void setQp(unsigned int qp);
+  void setStateVariable(ADReal & state, const Real & state_old);
+  virtual Real initialStateVariable() const { return 0.0; }
   virtual void frictionUpdate(ADRealVectorValue & traction, const RankTwoTensor & K);
+  const ADReal & slipRate() const { return _slip_rate; }
   void resetQpProperties() final {}
   void resetProperties() final {}
 
 protected:
   virtual ADReal frictionalStrength(const ADReal & delta_dot) = 0;
   virtual ADReal frictionalStrengthDeriv(const ADReal & delta_dot) = 0;
+  virtual bool linearStrength() const { return false; }
   virtual ADReal returnMap();
   virtual ADReal residual(const ADReal & delta_dot);
   virtual ADReal jacobian(const ADReal & delta_dot);
@@ -40,10 +44,20 @@ protected:
   const Real _rel_tol;
   unsigned int _max_its;
 
+  // Radiation damping coefficient
+  const Real _eta;
+
   // Friction update parameters
   ADRealVectorValue _traction_tr;
   ADReal _sigma_tr;
   ADReal _tau_tr;
   Real _kn;
   Real _ks;
+
+  // Slip rate of the last update
+  ADReal _slip_rate;
+
+  // State variable (stored by the interface material)
+  ADReal * _state;
+  const Real * _state_old;
 };
\ No newline at end of file
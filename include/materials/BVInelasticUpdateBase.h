@@ -15,18 +15,48 @@
 
 #include "Material.h"
 
+#include <functional>
+
+class SolutionUserObject;
+
 class BVInelasticUpdateBase : public Material
 {
 public:
   static InputParameters validParams();
   BVInelasticUpdateBase(const InputParameters & parameters);
   void setQp(unsigned int qp);
+  unsigned int iterations() const { return _iterations; }
   virtual void inelasticUpdate(ADRankTwoTensor & stress, const RankFourTensor & Cijkl) = 0;
   void resetQpProperties() final {}
   void resetProperties() final {}
 
+  /// Number of internal variables of the model
+  unsigned int numInternalVariables() const { return _internal_vars_old.size(); }
+  /// Appends the old values of the internal variables at the current quadrature point
+  void internalVariablesOld(std::vector<Real> & values) const;
+  /// Provider of the initial internal variables (element, qp, internal variable index, value)
+  typedef std::function<bool(const Elem *, unsigned int, unsigned int, Real &)>
+      InitialStateProvider;
+  void setInitialStateProvider(const InitialStateProvider & provider) { _initial_state = provider; }
+
 protected:
+  void registerInternalVariable(const std::string & name, const MaterialProperty<Real> & prop_old);
+  Real initialStateValue(const std::string & prop_name) const;
+
   const Real _abs_tol;
   const Real _rel_tol;
   unsigned int _max_its;
+
+  // Number of iterations of the last update
+  unsigned int _iterations;
+
+  // Initial internal state from a previous solution
+  const SolutionUserObject * const _initial_state_solution;
+  const std::vector<std::string> _initial_state_props;
+  const std::vector<std::string> _initial_state_vars;
+
+  // Internal variables (e.g. for the quadrature point traces)
+  std::vector<std::string> _internal_var_names;
+  std::vector<const MaterialProperty<Real> *> _internal_vars_old;
+  InitialStateProvider _initial_state;
 };
\ No newline at end of file
@@ -24,12 +24,16 @@ public:
   void initialSetup() override;
   void displacementIntegrityCheck();
   void initializeFrictionModel();
+  virtual void meshChanged() override;
+  Real maxStiffness() const;
 
 protected:
   virtual void initQpStatefulProperties() override;
+  virtual void computeProperties() override;
   virtual void computeQpProperties() override;
   virtual void computeQpDisplacementJump();
-  virtual void computeQpRotationMatrices();
+  void buildFaceRotations();
+  const std::vector<RankTwoTensor> & faceRotations() const;
   virtual void computeQpLocalDisplacementJump();
   virtual void computeQpLocalTraction();
   virtual void computeQpGlobalTraction();
@@ -51,13 +55,29 @@ protected:
   ADMaterialProperty<RealVectorValue> & _interface_displacement_jump_incr;
   ADMaterialProperty<RealVectorValue> & _interface_displacement_jump;
   const MaterialProperty<RealVectorValue> & _interface_displacement_jump_old;
-  MaterialProperty<RankTwoTensor> & _interface_total_rotation;
 
   // Traction properties
   ADMaterialProperty<RealVectorValue> & _interface_traction;
   const MaterialProperty<RealVectorValue> & _interface_traction_old;
   ADMaterialProperty<RealVectorValue> & _traction_global;
 
+  // Slip rate and friction state variable
+  ADMaterialProperty<Real> & _slip_rate;
+  ADMaterialProperty<Real> & _friction_state;
+  const MaterialProperty<Real> & _friction_state_old;
+
+  // Local frames of the interface faces, sorted by element id and side
+  struct InterfaceFace
+  {
+    dof_id_type elem_id;
+    unsigned int side;
+    std::vector<RankTwoTensor> rotations;
+  };
+  std::vector<InterfaceFace> _faces;
+  // Index of the first face of each element in _faces
+  std::unordered_map<dof_id_type, std::size_t> _face_index;
+  const std::vector<RankTwoTensor> * _rotations;
+
   // Friction model
   bool _has_friction;
   BVFrictionUpdateBase * _friction_model;
@@ -15,17 +15,23 @@
 
 #include "Material.h"
 #include "BVInelasticUpdateBase.h"
+#include "BVQpTrace.h"
+
+class SolutionUserObject;
 
 class BVMechanicalMaterial : public Material
 {
 public:
   static InputParameters validParams();
   BVMechanicalMaterial(const InputParameters & parameters);
+  virtual ~BVMechanicalMaterial();
   void initialSetup() override;
+  void timestepSetup() override;
   void elasticModuliInputCheck();
   void displacementIntegrityCheck();
   void initializeInelasticModels();
   void initializeInitialStress();
+  void initializeQpTrace();
 
 protected:
   virtual void initQpStatefulProperties() override;
@@ -38,6 +44,8 @@ protected:
   virtual void computeQpElasticityTensor();
   virtual void computeQpStress();
   virtual ADRankTwoTensor spinRotation(const ADRankTwoTensor & tensor);
+  virtual void recordQpTrace(const RankTwoTensor & trial_stress, const unsigned int iterations);
+  void flushQpTrace();
 
   // Coupled variables
   const unsigned int _ndisp;
@@ -51,12 +59,19 @@ protected:
   Real _bulk_modulus;
   Real _shear_modulus;
 
+  // Density
+  const Real _density;
+
   // Strain properties
   ADMaterialProperty<RankTwoTensor> & _strain_increment;
   ADMaterialProperty<RankTwoTensor> & _spin_increment;
 
-  // Elastic property
+  // Elastic properties
   ADMaterialProperty<Real> & _K;
+  ADMaterialProperty<Real> & _G;
+
+  // Bulk density property
+  ADMaterialProperty<Real> & _rho;
 
   // Stress properties
   ADMaterialProperty<RankTwoTensor> & _stress;
@@ -73,4 +88,17 @@ protected:
   // Initial stress
   unsigned int _num_ini_stress;
   std::vector<const Function *> _initial_stress;
+
+  // Initial stress from a previous solution
+  const SolutionUserObject * const _initial_stress_solution;
+  std::vector<std::string> _initial_stress_vars;
+
+  // Quadrature point traces
+  std::unique_ptr<BVQpTrace::Writer> _trace_writer;
+  std::set<dof_id_type> _trace_elems;
+  const unsigned int _trace_its;
+  const Real _trace_start_time;
+  const VariableValue * const _trace_temp;
+  std::set<std::pair<dof_id_type, unsigned int>> _traced_qps;
+  std::map<std::pair<dof_id_type, unsigned int>, BVQpTrace::Record> _trace_buffer;
 };
\ No newline at end of file
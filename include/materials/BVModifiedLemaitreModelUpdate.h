@@ -14,6 +14,7 @@
 #pragma once
 
 #include "BVCreepUpdateBase.h"
+#include "BVPowerExponent.h"
 
 class BVModifiedLemaitreModelUpdate : public BVCreepUpdateBase
 {
@@ -38,6 +39,16 @@ protected:
   const Real _beta1;
   const Real _beta2;
 
+  // Precomputed exponents
+  const BVPowerExponent _pow_beta1;
+  const BVPowerExponent _pow_beta2;
+  const BVPowerExponent _pow_beta1_m1;
+  const BVPowerExponent _pow_beta2_m1;
+  const BVPowerExponent _pow_inv_alpha;
+  const BVPowerExponent _pow_inv_alpha_m1;
+  const BVPowerExponent _pow_1m_inv_alpha;
+  const BVPowerExponent _pow_m_inv_alpha;
+
   // Internal variable for creep strain
   ADMaterialProperty<Real> & _eqv_creep_strain;
   const MaterialProperty<Real> & _eqv_creep_strain_old;
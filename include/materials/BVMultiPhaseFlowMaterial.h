@@ -27,6 +27,8 @@ protected:
   const ADMaterialProperty<Real> & _permeability;
   const ADMaterialProperty<Real> & _kr_w;
   const ADMaterialProperty<Real> & _kr_n;
+  const ADMaterialProperty<Real> & _dkr_w;
+  const ADMaterialProperty<Real> & _dkr_n;
   const ADMaterialProperty<Real> & _viscosity_w;
   const ADMaterialProperty<Real> & _viscosity_n;
   const ADMaterialProperty<Real> & _dpc;
@@ -34,5 +36,6 @@ protected:
   ADMaterialProperty<Real> & _lambda;
   ADMaterialProperty<Real> & _f_w;
   ADMaterialProperty<Real> & _f_n;
+  ADMaterialProperty<Real> & _df_w;
   ADMaterialProperty<Real> & _D;
 };
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "BVDeviatoricVolumetricUpdateBase.h"
+#include "BVPowerExponent.h"
 
 class BVRTL2020ModelUpdate : public BVDeviatoricVolumetricUpdateBase
 {
@@ -71,6 +72,21 @@ protected:
   const Real _Mz;
   const Real _mz;
 
+  // Precomputed exponents
+  const BVPowerExponent _pow_n2;
+  const BVPowerExponent _pow_n2_m1;
+  const BVPowerExponent _pow_1m_inv_alpha;
+  const BVPowerExponent _pow_m_inv_alpha;
+  const BVPowerExponent _pow_n1;
+  const BVPowerExponent _pow_n;
+  const BVPowerExponent _pow_m;
+  const BVPowerExponent _pow_n_m1;
+  const BVPowerExponent _pow_m_m1;
+  const BVPowerExponent _pow_nz;
+  const BVPowerExponent _pow_mz;
+  const BVPowerExponent _pow_nz_m1;
+  const BVPowerExponent _pow_mz_m1;
+
   // Internal variable for Lemaitre and Munson-Dawson creep strain
   ADMaterialProperty<Real> & _eqv_creep_strain_L;
   const MaterialProperty<Real> & _eqv_creep_strain_L_old;
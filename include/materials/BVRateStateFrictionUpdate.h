@@ -0,0 +1,42 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "BVFrictionUpdateBase.h"
+
+class BVRateStateFrictionUpdate : public BVFrictionUpdateBase
+{
+public:
+  static InputParameters validParams();
+  BVRateStateFrictionUpdate(const InputParameters & parameters);
+  virtual Real initialStateVariable() const override;
+
+protected:
+  virtual ADReal frictionalStrength(const ADReal & delta_dot) override;
+  virtual ADReal frictionalStrengthDeriv(const ADReal & delta_dot) override;
+  virtual ADReal returnMap() override;
+  virtual void postReturnMap(const ADReal & delta_dot) override;
+  virtual ADReal frictionCoefficient(const ADReal & delta_dot, const ADReal & state);
+  virtual ADReal stateVariable(const ADReal & delta_dot);
+  virtual ADReal stateVariableLogDeriv(const ADReal & delta_dot);
+
+  // Rate-and-state friction parameters
+  const Real _a;
+  const Real _b;
+  const Real _Dc;
+  const Real _V0;
+  const Real _f0;
+  const Real _theta0;
+  const unsigned int _law;
+};
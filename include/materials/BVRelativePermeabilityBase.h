@@ -27,6 +27,6 @@ protected:
   const ADVariableValue & _sw;
   ADMaterialProperty<Real> & _kr_w;
   ADMaterialProperty<Real> & _kr_n;
-  // ADMaterialProperty<Real> & _dkr_w;
-  // ADMaterialProperty<Real> & _dkr_n;
+  ADMaterialProperty<Real> & _dkr_w;
+  ADMaterialProperty<Real> & _dkr_n;
 };
\ No newline at end of file
@@ -14,6 +14,7 @@
 #pragma once
 
 #include "BVRelativePermeabilityBase.h"
+#include "BVPowerExponent.h"
 
 class BVRelativePermeabilityPowerLaw : public BVRelativePermeabilityBase
 {
@@ -25,4 +26,6 @@ protected:
   virtual void computeQpProperties() override;
   
   const Real _n;
+  const BVPowerExponent _pow_n;
+  const BVPowerExponent _pow_dn;
 };
\ No newline at end of file
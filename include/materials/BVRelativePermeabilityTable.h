@@ -0,0 +1,30 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "BVRelativePermeabilityBase.h"
+#include "BVMonotoneSpline.h"
+
+class BVRelativePermeabilityTable : public BVRelativePermeabilityBase
+{
+public:
+  static InputParameters validParams();
+  BVRelativePermeabilityTable(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  BVMonotoneSpline _kr_w_table;
+  BVMonotoneSpline _kr_n_table;
+};
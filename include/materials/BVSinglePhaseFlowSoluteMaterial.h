@@ -26,5 +26,7 @@ protected:
 
   const ADMaterialProperty<Real> & _porosity;
   const ADMaterialProperty<Real> & _dispersion;
+  const ADMaterialProperty<std::vector<Real>> & _species_dispersion;
   ADMaterialProperty<Real> & _lambda_c;
+  ADMaterialProperty<std::vector<Real>> & _species_lambda_c;
 };
@@ -0,0 +1,35 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "BVMechanicalMaterial.h"
+
+class BVTraceReplayMaterial : public BVMechanicalMaterial
+{
+public:
+  static InputParameters validParams();
+  BVTraceReplayMaterial(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpStrainIncrement() override;
+  const BVQpTrace::Record * currentRecord(const unsigned int t_step) const;
+
+  // Recorded histories (one per element of the replay mesh)
+  const std::vector<BVQpTrace::History> _histories;
+  // Index of the history replayed by each element (elements sorted by id)
+  std::unordered_map<dof_id_type, std::size_t> _history_index;
+};
@@ -23,18 +23,44 @@ public:
   std::unique_ptr<MeshBase> generate() override;
 
 protected:
-  std::map<boundary_id_type, std::set<dof_id_type>>
-  getSidesetNodes(const std::vector<BndElement *> & bnd_elems,
-                  const std::set<boundary_id_type> & mesh_sideset_ids);
-  std::map<boundary_id_type, std::set<std::vector<dof_id_type>>>
-  splitNodesOnInterface(const std::map<boundary_id_type, std::set<dof_id_type>> & bnd_node_ids,
+  // A face of the interface, stored once from the element with the larger id
+  struct FaultFace
+  {
+    dof_id_type elem_id;
+    unsigned int side;
+    dof_id_type neighbor_id;
+    // Lowest id of the elements listing this face in the sideset (orientation seed)
+    dof_id_type seed_elem_id;
+    // Orientation of the face (+1 if the element is on the side the normal points to)
+    int sign;
+    RealVectorValue normal;
+    std::vector<dof_id_type> nodes;
+  };
+
+  uint64_t hashInputMesh(const MeshBase & mesh) const;
+  void writeCache(MeshBase & mesh, const std::string & cache_file) const;
+  std::vector<FaultFace>
+  getSidesetFaces(const std::vector<std::pair<dof_id_type, unsigned int>> & sides,
+                  std::unique_ptr<MeshBase> & mesh);
+  void gatherFaces(std::vector<FaultFace> & faces, std::unique_ptr<MeshBase> & mesh);
+  std::map<dof_id_type, std::vector<unsigned int>>
+  getNodeToFaceMap(const std::vector<FaultFace> & faces);
+  void orientFaces(std::vector<FaultFace> & faces,
+                   const std::map<dof_id_type, std::vector<unsigned int>> & node_to_face_map);
+  std::map<dof_id_type, dof_id_type>
+  splitNodesOnInterface(const std::map<dof_id_type, std::vector<unsigned int>> & node_to_face_map,
                         std::unique_ptr<MeshBase> & mesh);
   void stitchNodesToElems(
-      const std::map<boundary_id_type, std::set<std::vector<dof_id_type>>> & split_nodes_map,
-      std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
-      const std::vector<BndElement *> & bnd_elems,
+      const std::map<dof_id_type, dof_id_type> & split_nodes_map,
+      const std::vector<FaultFace> & faces,
+      const std::map<dof_id_type, std::vector<unsigned int>> & node_to_face_map,
+      std::unordered_map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
       std::unique_ptr<MeshBase> & mesh);
 
+  // Ids of the duplicate of the first split node of the current sideset
+  dof_id_type _first_new_id;
+  unique_id_type _first_new_unique_id;
+
   std::unique_ptr<MeshBase> & _input;
   const std::vector<BoundaryName> _sideset_names;
 };
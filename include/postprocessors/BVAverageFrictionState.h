@@ -0,0 +1,33 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "InterfacePostprocessor.h"
+
+class BVAverageFrictionState : public InterfacePostprocessor
+{
+public:
+  static InputParameters validParams();
+  BVAverageFrictionState(const InputParameters & parameters);
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  const ADMaterialProperty<Real> & _state;
+  Real _integral;
+  Real _area;
+};
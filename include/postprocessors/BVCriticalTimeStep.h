@@ -0,0 +1,41 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+class BVMechanicalInterfaceMaterial;
+
+class BVCriticalTimeStep : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+  BVCriticalTimeStep(const InputParameters & parameters);
+  virtual void initialSetup() override;
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  const Real _factor;
+  const ADMaterialProperty<Real> & _rho;
+  const ADMaterialProperty<Real> & _K;
+  const ADMaterialProperty<Real> & _G;
+
+  // Interface materials and their boundaries
+  std::vector<const BVMechanicalInterfaceMaterial *> _interfaces;
+  Real _critical_dt;
+};
@@ -0,0 +1,39 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "ElementPostprocessor.h"
+
+class BVFVStableTimeStep : public ElementPostprocessor
+{
+public:
+  static InputParameters validParams();
+  BVFVStableTimeStep(const InputParameters & parameters);
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual Real getValue() const override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  const enum class TransportEnum { SATURATION, SOLUTE } _transport;
+  const MooseVariableFV<Real> * _p_var;
+  const Real _cfl;
+  const Real _diffusion_number;
+  const ADMaterialProperty<Real> & _porosity;
+  const ADMaterialProperty<Real> & _lambda;
+  const ADMaterialProperty<Real> * _df;
+  const ADMaterialProperty<Real> & _D;
+  Real _stable_dt;
+};
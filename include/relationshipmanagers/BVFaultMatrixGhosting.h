@@ -0,0 +1,43 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "RelationshipManager.h"
+
+/**
+ * Ghosts and couples the lower dimensional fault elements with the matrix elements on both sides
+ * of the fault, including across a split interface where the matrix elements are not neighbors.
+ */
+class BVFaultMatrixGhosting : public RelationshipManager
+{
+public:
+  static InputParameters validParams();
+  BVFaultMatrixGhosting(const InputParameters & parameters);
+  BVFaultMatrixGhosting(const BVFaultMatrixGhosting & other);
+
+  virtual void operator()(const MeshBase::const_element_iterator & range_begin,
+                          const MeshBase::const_element_iterator & range_end,
+                          processor_id_type p,
+                          map_type & coupled_elements) override;
+  virtual std::string getInfo() const override;
+  virtual bool operator>=(const RelationshipManager & other) const override;
+  virtual std::unique_ptr<GhostingFunctor> clone() const override;
+  virtual void mesh_reinit() override;
+
+protected:
+  virtual void internalInitWithMesh(const MeshBase & mesh) override;
+
+  // Fault and matrix elements coupled to each element
+  std::unordered_map<const Elem *, std::vector<const Elem *>> _coupled_elems;
+};
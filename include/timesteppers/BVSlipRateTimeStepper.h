@@ -0,0 +1,35 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "TimeStepper.h"
+#include "PostprocessorInterface.h"
+
+class BVSlipRateTimeStepper : public TimeStepper, public PostprocessorInterface
+{
+public:
+  static InputParameters validParams();
+  BVSlipRateTimeStepper(const InputParameters & parameters);
+
+protected:
+  virtual Real computeInitialDT() override;
+  virtual Real computeDT() override;
+
+  const PostprocessorValue & _slip_rate;
+  const Real _slip_increment;
+  const Real _dt_initial;
+  const Real _dt_min;
+  const Real _dt_max;
+  const Real _growth_factor;
+};
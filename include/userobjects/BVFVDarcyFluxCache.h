@@ -0,0 +1,45 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "FaceInfo.h"
+
+/**
+ * Holds the Darcy velocity of the face currently assembled by each thread so that the transport
+ * kernels of several species evaluate it only once per face. The kernels invalidate their thread
+ * entry before each residual or Jacobian evaluation.
+ */
+class BVFVDarcyFluxCache : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+  BVFVDarcyFluxCache(const InputParameters & parameters);
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Forget the velocity stored for a thread
+  void invalidate(const THREAD_ID tid) const;
+
+  /// Pointer to the velocity stored for a face (nullptr if not stored)
+  const ADRealVectorValue * find(const THREAD_ID tid, const FaceInfo * fi) const;
+
+  /// Store the velocity of a face
+  void store(const THREAD_ID tid, const FaceInfo * fi, const ADRealVectorValue & u) const;
+
+protected:
+  mutable std::vector<const FaceInfo *> _face;
+  mutable std::vector<ADRealVectorValue> _velocity;
+};
@@ -0,0 +1,51 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+#include "FaceInfo.h"
+
+/**
+ * Holds the total mobility on both sides of each face, as evaluated by the pressure kernel with the
+ * latest saturation iterate. The saturation kernels of a sequential solve build the total velocity
+ * from these values so that it stays frozen within an outer iteration.
+ */
+class BVFVLaggedMobility : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+  BVFVLaggedMobility(const InputParameters & parameters);
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// Store the mobilities on the element and neighbor sides of a face
+  void store(const FaceInfo & fi, const Real lambda_elem, const Real lambda_neighbor) const;
+
+  /// Mobility on the element side of a face
+  Real elemMobility(const FaceInfo & fi) const;
+
+  /// Mobility on the neighbor side of a face
+  Real neighborMobility(const FaceInfo & fi) const;
+
+protected:
+  void resize();
+  void checkStored(const FaceInfo & fi) const;
+
+  mutable std::vector<Real> _lambda_elem;
+  mutable std::vector<Real> _lambda_neighbor;
+  mutable std::vector<unsigned char> _stored;
+};
@@ -0,0 +1,30 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "GeneralUserObject.h"
+
+class BVGeostaticEquilibration : public GeneralUserObject
+{
+public:
+  static InputParameters validParams();
+  BVGeostaticEquilibration(const InputParameters & parameters);
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  const unsigned int _equilibration_steps;
+  std::vector<VariableName> _disp_names;
+};
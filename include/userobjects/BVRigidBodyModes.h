@@ -0,0 +1,42 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "NodalUserObject.h"
+#include "libmesh/nonlinear_implicit_system.h"
+
+class NonlinearSystemBase;
+
+class BVRigidBodyModes : public NodalUserObject,
+                         public libMesh::NonlinearImplicitSystem::ComputeVectorSubspace
+{
+public:
+  static InputParameters validParams();
+  BVRigidBodyModes(const InputParameters & parameters);
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void threadJoin(const UserObject & /*uo*/) override {}
+  virtual void finalize() override;
+
+  /// Near null space handed to the nonlinear solver
+  virtual void operator()(std::vector<NumericVector<Number> *> & sp,
+                          libMesh::NonlinearImplicitSystem & S) override;
+
+protected:
+  NonlinearSystemBase & _nl;
+  const unsigned int _ndisp;
+  std::vector<unsigned int> _disp_num;
+  const unsigned int _nmodes;
+  std::vector<std::string> _mode_names;
+};
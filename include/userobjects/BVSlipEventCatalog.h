@@ -0,0 +1,62 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "InterfaceUserObject.h"
+#include "BVAsyncFileWriter.h"
+
+class BVSlipEventCatalog : public InterfaceUserObject
+{
+public:
+  static InputParameters validParams();
+  BVSlipEventCatalog(const InputParameters & parameters);
+  virtual ~BVSlipEventCatalog();
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual void threadJoin(const UserObject & y) override;
+
+protected:
+  typedef std::pair<dof_id_type, unsigned int> FaceKey;
+
+  struct SlipEvent
+  {
+    Real origin_time;
+    Real end_time;
+    // Area and cumulated slip of each face involved in the event
+    std::map<FaceKey, std::pair<Real, Real>> faces;
+  };
+
+  std::vector<std::vector<unsigned int>> clusterFaces() const;
+  void updateEvents(const std::vector<std::vector<unsigned int>> & clusters);
+  void writeEvent(const SlipEvent & event);
+
+  const ADMaterialProperty<Real> & _slip_rate;
+  const Real _threshold;
+  const Real _G;
+
+  // Out-of-plane length of a 2D fault (0 if the areas and moments are per unit length)
+  Real _length;
+
+  // Slipping faces of the current time step (flattened for communication)
+  std::vector<dof_id_type> _face_ids;
+  std::vector<Real> _face_data;
+  std::vector<unsigned int> _face_n_nodes;
+  std::vector<dof_id_type> _face_nodes;
+
+  // Ongoing events (root processor only)
+  std::vector<SlipEvent> _events;
+  unsigned int _n_events;
+  std::unique_ptr<BVAsyncFileWriter> _writer;
+};
@@ -0,0 +1,46 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "Moose.h"
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+/**
+ * Appends lines to a file from a background thread so that the simulation does not wait on
+ * the file system.
+ */
+class BVAsyncFileWriter
+{
+public:
+  BVAsyncFileWriter(const std::string & file_name, const std::string & header);
+  ~BVAsyncFileWriter();
+
+  /// Queue a line (without its end of line character) for writing
+  void push(std::string line);
+
+protected:
+  void run();
+
+  std::ofstream _file;
+  std::deque<std::string> _queue;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _done;
+  std::thread _thread;
+};
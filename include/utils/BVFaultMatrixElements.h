@@ -0,0 +1,37 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+
+#include "libmesh/elem.h"
+#include "libmesh/point_locator_base.h"
+
+namespace BVFaultMatrixElements
+{
+
+/**
+ * Get the matrix elements on both sides of a lower dimensional fault element: its interior parent
+ * and the element across the parent side. If the fault nodes were split (the parent side has no
+ * neighbor), the opposite element is located geometrically, just across the fault element.
+ * param fault_elem the lower dimensional fault element
+ * param locator a point locator of the mesh (in out of mesh mode)
+ * param matrix_blocks the subdomains of the matrix elements
+ * Missing (e.g. not ghosted) elements are returned as nullptr.
+ */
+std::pair<const Elem *, const Elem *>
+matrixElements(const Elem * fault_elem,
+               const PointLocatorBase & locator,
+               const std::set<subdomain_id_type> & matrix_blocks);
+}
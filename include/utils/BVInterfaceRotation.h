@@ -0,0 +1,27 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "RankTwoTensor.h"
+
+namespace BVInterfaceRotation
+{
+
+/**
+ * Get the rotation from the local frame of an interface (normal, tangents) to the global frame
+ * param normal the unit normal of the interface
+ * param mesh_dimension the dimension of the mesh (1, 2 or 3)
+ */
+RankTwoTensor referenceRotation(const RealVectorValue & normal, const unsigned int mesh_dimension);
+}
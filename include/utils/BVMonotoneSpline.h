@@ -0,0 +1,72 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "metaphysicl/raw_type.h"
+
+/**
+ * Monotone piecewise cubic Hermite interpolation (Fritsch-Carlson) of tabulated data. Monotone
+ * data remains monotone between the nodes. The interval containing a point is found in constant
+ * time: directly on uniform grids and through a uniform bin index otherwise. Values are held
+ * constant outside of the table.
+ */
+class BVMonotoneSpline
+{
+public:
+  BVMonotoneSpline() = default;
+  BVMonotoneSpline(const std::vector<Real> & x, const std::vector<Real> & y);
+
+  /// Set the table (x must be strictly increasing)
+  void setData(const std::vector<Real> & x, const std::vector<Real> & y);
+
+  /// Whether the abscissae are equally spaced
+  bool isUniform() const { return _uniform; }
+
+  /// Value and derivative at x
+  void evaluate(const Real x, Real & y, Real & dy) const;
+
+  /// Value at x
+  Real value(const Real x) const;
+
+  /// Derivative at x
+  Real derivative(const Real x) const;
+
+  /// Value at x, carrying the derivatives for AD types
+  template <typename T>
+  T operator()(const T & x) const
+  {
+    const Real x_raw = MetaPhysicL::raw_value(x);
+    Real y, dy;
+    evaluate(x_raw, y, dy);
+    return y + dy * (x - x_raw);
+  }
+
+  /// Evaluate a batch of points
+  void evaluate(const std::vector<Real> & x, std::vector<Real> & y, std::vector<Real> & dy) const;
+
+protected:
+  /// Index of the interval containing x (x within the table)
+  unsigned int interval(const Real x) const;
+
+  std::vector<Real> _x;
+  std::vector<Real> _y;
+  /// Nodal slopes
+  std::vector<Real> _m;
+  bool _uniform = false;
+  Real _inv_dx = 0.0;
+  /// First interval intersecting each bin for non-uniform tables
+  std::vector<unsigned int> _bin_start;
+  Real _inv_bin = 0.0;
+};
@@ -0,0 +1,120 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "libmesh/utility.h"
+#include "metaphysicl/raw_type.h"
+
+/**
+ * Power function with an exponent known at setup. Integer and half-integer exponents are
+ * evaluated with multiplications (and a square root) instead of the generic std::pow which is
+ * particularly costly for AD types.
+ */
+class BVPowerExponent
+{
+public:
+  BVPowerExponent(const Real exponent) : _exponent(exponent), _type(ExponentType::GENERAL), _n(0)
+  {
+    const Real two_e = 2.0 * exponent;
+    if (std::abs(two_e - std::round(two_e)) > libMesh::TOLERANCE * libMesh::TOLERANCE ||
+        std::abs(two_e) > 2.0 * _max_integer + 1.0)
+      return;
+
+    _n = static_cast<int>(std::round(two_e));
+    if (_n % 2 == 0)
+    {
+      _type = ExponentType::INTEGER;
+      _n /= 2;
+    }
+    else
+      _type = ExponentType::HALF_INTEGER;
+  }
+
+  /// The exponent
+  Real exponent() const { return _exponent; }
+
+  /// Whether the exponent is evaluated without std::pow
+  bool isSpecialized() const { return _type != ExponentType::GENERAL; }
+
+  /// Computes x^exponent
+  template <typename T>
+  T operator()(const T & x) const
+  {
+    switch (_type)
+    {
+      case ExponentType::INTEGER:
+        return _n >= 0 ? integerPow(x, _n) : 1.0 / integerPow(x, -_n);
+      case ExponentType::HALF_INTEGER:
+      {
+        // The derivative of sqrt(x) is infinite at zero, while x^(m/2) and its derivative vanish
+        // there for m > 2
+        if (_n > 2 && MetaPhysicL::raw_value(x) == 0.0)
+          return T(0.0);
+
+        // x^(m/2) = x^((|m| - 1) / 2) * sqrt(x) for odd m
+        using std::sqrt;
+        const T r = integerPow(x, (std::abs(_n) - 1) / 2) * sqrt(x);
+        return _n > 0 ? r : 1.0 / r;
+      }
+      default:
+        using std::pow;
+        return pow(x, _exponent);
+    }
+  }
+
+protected:
+  enum class ExponentType
+  {
+    INTEGER,
+    HALF_INTEGER,
+    GENERAL
+  };
+
+  /// Largest integer exponent unrolled at compile time
+  static constexpr int _max_integer = 8;
+
+  template <typename T>
+  static T integerPow(const T & x, const int n)
+  {
+    switch (n)
+    {
+      case 0:
+        return Utility::pow<0>(x);
+      case 1:
+        return x;
+      case 2:
+        return Utility::pow<2>(x);
+      case 3:
+        return Utility::pow<3>(x);
+      case 4:
+        return Utility::pow<4>(x);
+      case 5:
+        return Utility::pow<5>(x);
+      case 6:
+        return Utility::pow<6>(x);
+      case 7:
+        return Utility::pow<7>(x);
+      case 8:
+        return Utility::pow<8>(x);
+      default:
+        using std::pow;
+        return pow(x, Real(n));
+    }
+  }
+
+  const Real _exponent;
+  ExponentType _type;
+  int _n;
+};
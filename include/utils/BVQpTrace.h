@@ -0,0 +1,73 @@
+/******************************************************************************/
+/*                            This file is part of                            */
+/*                       BEAVER, a MOOSE-based application                    */
+/*       Multiphase Flow Poromechanics for Induced Seismicity Problems        */
+/*                                                                            */
+/*                  Copyright (C) 2024 by Antoine B. Jacquey                  */
+/*                           Polytechnique Montréal                           */
+/*                                                                            */
+/*            Licensed under GNU Lesser General Public License v2.1           */
+/*                       please see LICENSE for details                       */
+/*                 or http://www.gnu.org/licenses/lgpl.html                   */
+/******************************************************************************/
+
+#pragma once
+
+#include "MooseTypes.h"
+#include "RankTwoTensor.h"
+
+#include <fstream>
+
+/**
+ * Compact binary traces of the loading history of quadrature points. A trace is a sequence of
+ * records (one per traced quadrature point and time step) which can be replayed to run the
+ * inelastic models on the history of a production run.
+ */
+namespace BVQpTrace
+{
+
+struct Record
+{
+  dof_id_type elem_id = 0;
+  unsigned int qp = 0;
+  int t_step = 0;
+  Real t = 0.0;
+  Real dt = 0.0;
+  Real temperature = 0.0;
+  RankTwoTensor strain_increment;
+  RankTwoTensor spin_increment;
+  RankTwoTensor stress_old;
+  RankTwoTensor trial_stress;
+  unsigned int iterations = 0;
+  /// Internal variables of the inelastic models at the beginning of the time step
+  std::vector<Real> internal_state_old;
+};
+
+/// Loading history of a single quadrature point sorted by time step
+typedef std::vector<Record> History;
+
+class Writer
+{
+public:
+  Writer(const std::string & file_name);
+  void write(const Record & record);
+  void flush();
+
+protected:
+  std::ofstream _file;
+};
+
+/**
+ * Reads one or several trace files and returns the history of each traced quadrature point
+ * sorted by element id and quadrature point. When a time step has been recorded several times
+ * (e.g. after a cut back), the last record is kept.
+ */
+std::vector<History> readHistories(const std::vector<std::string> & file_names);
+
+/**
+ * Whether all histories have been recorded on the same time steps, i.e. whether they can be
+ * replayed on a single clock.
+ */
+bool sameTimeSteps(const std::vector<History> & histories);
+
+}
@@ -0,0 +1,212 @@
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    xmin = 0
+    xmax = 1
+    ymin = -1
+    ymax = 0
+    nx = 4
+    ny = 8
+  []
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+  []
+[]
+
+[Kernels]
+  [mech_x]
+    type = BVStressDivergence
+    variable = disp_x
+    component = x
+  []
+  [mech_y]
+    type = BVStressDivergence
+    variable = disp_y
+    component = y
+  []
+[]
+
+[Functions]
+  # Unbalanced initial stress: the lateral stress varies with depth
+  [sxx]
+    type = ParsedFunction
+    expression = '2.0 * y'
+  []
+  [syy]
+    type = ParsedFunction
+    expression = '-1.0'
+  []
+  [szz]
+    type = ParsedFunction
+    expression = '-1.0'
+  []
+[]
+
+[AuxVariables]
+  [stress_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_zz]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_yz]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_xz]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [stress_xx_aux]
+    type = BVStressComponentAux
+    variable = stress_xx
+    index_i = x
+    index_j = x
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_yy_aux]
+    type = BVStressComponentAux
+    variable = stress_yy
+    index_i = y
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_zz_aux]
+    type = BVStressComponentAux
+    variable = stress_zz
+    index_i = z
+    index_j = z
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_yz_aux]
+    type = BVStressComponentAux
+    variable = stress_yz
+    index_i = y
+    index_j = z
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_xz_aux]
+    type = BVStressComponentAux
+    variable = stress_xz
+    index_i = x
+    index_j = z
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_xy_aux]
+    type = BVStressComponentAux
+    variable = stress_xy
+    index_i = x
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[BCs]
+  [no_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'left'
+    value = 0.0
+  []
+  [no_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom'
+    value = 0.0
+  []
+[]
+
+[Materials]
+  [mech_elastic]
+    type = BVMechanicalMaterial
+    displacements = 'disp_x disp_y'
+    bulk_modulus = 10.0e+03
+    shear_modulus = 10.0e+03
+    initial_stress = 'sxx syy szz'
+  []
+[]
+
+[UserObjects]
+  [equilibration]
+    type = BVGeostaticEquilibration
+    displacements = 'disp_x disp_y'
+    equilibration_steps = 1
+  []
+[]
+
+[Postprocessors]
+  # The displacements must stay zero after the equilibration step
+  [disp_x_norm]
+    type = ElementL2Norm
+    variable = disp_x
+    outputs = csv
+  []
+  [disp_y_norm]
+    type = ElementL2Norm
+    variable = disp_y
+    outputs = csv
+  []
+  # The equilibrated stress must be kept
+  [stress_xx_norm]
+    type = ElementL2Norm
+    variable = stress_xx
+    outputs = none
+  []
+  [stress_yy_norm]
+    type = ElementL2Norm
+    variable = stress_yy
+    outputs = none
+  []
+  [stress_xx_change]
+    type = ChangeOverTimePostprocessor
+    postprocessor = stress_xx_norm
+    outputs = csv
+  []
+  [stress_yy_change]
+    type = ChangeOverTimePostprocessor
+    postprocessor = stress_yy_norm
+    outputs = csv
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  nl_rel_tol = 1.0e-12
+  start_time = 0.0
+  end_time = 2.0
+  dt = 1.0
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  print_linear_residuals = false
+  exodus = true
+  [csv]
+    type = CSV
+    file_base = 'geostatic_equilibration_csv'
+    execute_on = 'FINAL'
+  []
+[]
@@ -0,0 +1,159 @@
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    xmin = 0
+    xmax = 1
+    ymin = -1
+    ymax = 0
+    nx = 4
+    ny = 8
+  []
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+  []
+[]
+
+[Kernels]
+  [mech_x]
+    type = BVStressDivergence
+    variable = disp_x
+    component = x
+  []
+  [mech_y]
+    type = BVStressDivergence
+    variable = disp_y
+    component = y
+  []
+[]
+
+[BCs]
+  [no_x]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'left'
+    value = 0.0
+  []
+  [no_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom'
+    value = 0.0
+  []
+[]
+
+[AuxVariables]
+  [stress_xx]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_xx_file]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_yy_file]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [stress_xx_aux]
+    type = BVStressComponentAux
+    variable = stress_xx
+    index_i = x
+    index_j = x
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_yy_aux]
+    type = BVStressComponentAux
+    variable = stress_yy
+    index_i = y
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_xx_file_aux]
+    type = SolutionAux
+    variable = stress_xx_file
+    solution = geostatic
+    from_variable = stress_xx
+    execute_on = 'INITIAL'
+  []
+  [stress_yy_file_aux]
+    type = SolutionAux
+    variable = stress_yy_file
+    solution = geostatic
+    from_variable = stress_yy
+    execute_on = 'INITIAL'
+  []
+[]
+
+[UserObjects]
+  [geostatic]
+    type = SolutionUserObject
+    mesh = 'geostatic_equilibration_out.e'
+    system_variables = 'stress_xx stress_yy stress_zz stress_yz stress_xz stress_xy'
+    timestep = LATEST
+    execute_on = 'INITIAL'
+  []
+[]
+
+[Materials]
+  [mech_elastic]
+    type = BVMechanicalMaterial
+    displacements = 'disp_x disp_y'
+    bulk_modulus = 10.0e+03
+    shear_modulus = 10.0e+03
+    initial_stress_solution = 'geostatic'
+    initial_stress_variables = 'stress_xx stress_yy stress_zz stress_yz stress_xz stress_xy'
+  []
+[]
+
+[Postprocessors]
+  # The stress read from the solution is balanced: no displacement and no stress change
+  [disp_x_norm]
+    type = ElementL2Norm
+    variable = disp_x
+  []
+  [disp_y_norm]
+    type = ElementL2Norm
+    variable = disp_y
+  []
+  [stress_xx_diff]
+    type = ElementL2Difference
+    variable = stress_xx
+    other_variable = stress_xx_file
+  []
+  [stress_yy_diff]
+    type = ElementL2Difference
+    variable = stress_yy
+    other_variable = stress_yy_file
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  nl_rel_tol = 1.0e-12
+  start_time = 0.0
+  end_time = 1.0
+  dt = 1.0
+[]
+
+[Outputs]
+  execute_on = 'TIMESTEP_END'
+  print_linear_residuals = false
+  csv = true
+[]
@@ -0,0 +1,145 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  nx = 6
+  ny = 6
+  nz = 6
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_z]
+    order = FIRST
+    family = LAGRANGE
+  []
+[]
+
+[Kernels]
+  [stress_x]
+    type = BVStressDivergence
+    component = x
+    variable = disp_x
+  []
+  [stress_y]
+    type = BVStressDivergence
+    component = y
+    variable = disp_y
+  []
+  [stress_z]
+    type = BVStressDivergence
+    component = z
+    variable = disp_z
+  []
+[]
+
+[Postprocessors]
+  [num_lin_its]
+    type = NumLinearIterations
+    outputs = none
+  []
+  # Linear iterations of the same problem without the rigid body modes
+  [num_lin_its_reference]
+    type = Receiver
+    outputs = none
+  []
+  # The rigid body modes improve the coarse spaces of AMG
+  [fewer_lin_its]
+    type = ParsedPostprocessor
+    expression = 'if(num_lin_its < num_lin_its_reference, 1, 0)'
+    pp_names = 'num_lin_its num_lin_its_reference'
+  []
+[]
+
+[BCs]
+  [symmy]
+    type = DirichletBC
+    variable = disp_y
+    boundary = bottom
+    value = 0
+  []
+  [symmx]
+    type = DirichletBC
+    variable = disp_x
+    boundary = left
+    value = 0
+  []
+  [symmz]
+    type = DirichletBC
+    variable = disp_z
+    boundary = back
+    value = 0
+  []
+  [tdisp]
+    type = DirichletBC
+    variable = disp_z
+    boundary = front
+    value = 0.1
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = BVMechanicalMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 8.0e+09
+    shear_modulus = 3.5e+09
+  []
+[]
+
+[UserObjects]
+  [rigid_body_modes]
+    type = BVRigidBodyModes
+    displacements = 'disp_x disp_y disp_z'
+  []
+[]
+
+[MultiApps]
+  [reference]
+    type = FullSolveMultiApp
+    input_files = 'rigid_body_modes.i'
+    cli_args = 'UserObjects/inactive=rigid_body_modes;MultiApps/inactive=reference;Transfers/inactive=reference_its'
+    execute_on = 'INITIAL'
+  []
+[]
+
+[Transfers]
+  [reference_its]
+    type = MultiAppPostprocessorTransfer
+    from_multi_app = reference
+    from_postprocessor = num_lin_its
+    to_postprocessor = num_lin_its_reference
+    reduction_type = maximum
+    execute_on = 'INITIAL'
+  []
+[]
+
+[Preconditioning]
+  [gamg]
+    type = SMP
+    full = true
+    petsc_options_iname = '-pc_type -pc_gamg_type -ksp_rtol'
+    petsc_options_value = 'gamg agg 1.0e-10'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.05
+  solve_type = 'NEWTON'
+  dtmin = 0.05
+  num_steps = 1
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = 'FINAL'
+  []
+[]
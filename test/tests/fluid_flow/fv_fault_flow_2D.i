@@ -0,0 +1,205 @@
+[Mesh]
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 20
+    ny = 10
+    xmin = -50
+    xmax = 50
+    ymin = 0
+    ymax = 50
+  []
+  [fault_sideset]
+    type = ParsedGenerateSideset
+    input = mesh
+    combinatorial_geometry = 'abs(x) < 1.0e-06'
+    normal = '1 0 0'
+    new_sideset_name = 'fault'
+  []
+  [fault_gen]
+    type = BVFaultInterfaceGenerator
+    input = fault_sideset
+    sidesets = 'fault'
+  []
+  [fault_block]
+    type = LowerDBlockFromSidesetGenerator
+    input = fault_gen
+    sidesets = 'fault'
+    new_block_id = 1
+    new_block_name = 'fault'
+  []
+[]
+
+[Variables]
+  [pm]
+    type = MooseVariableFVReal
+    block = 0
+  []
+  [pf]
+    type = MooseVariableFVReal
+    block = 'fault'
+  []
+[]
+
+[FVKernels]
+  [matrix_time_derivative]
+    type = BVFVSinglePhaseTimeDerivative
+    variable = pm
+  []
+  [matrix_darcy]
+    type = BVFVSinglePhaseDarcy
+    variable = pm
+  []
+  [matrix_exchange]
+    type = BVFVFaultMatrixExchange
+    variable = pm
+    fault_pressure = pf
+    matrix_pressure = pm
+    exchange_coefficient = 1.0e-12
+  []
+  [fault_time_derivative]
+    type = BVFVFaultTimeDerivative
+    variable = pf
+  []
+  [fault_darcy]
+    type = BVFVFaultDarcy
+    variable = pf
+  []
+  [fault_exchange]
+    type = BVFVFaultMatrixExchange
+    variable = pf
+    fault_pressure = pf
+    matrix_pressure = pm
+    exchange_coefficient = 1.0e-12
+  []
+[]
+
+[AuxVariables]
+  [pm_left]
+    order = CONSTANT
+    family = MONOMIAL
+    block = 0
+  []
+  [pm_right]
+    order = CONSTANT
+    family = MONOMIAL
+    block = 0
+  []
+[]
+
+[AuxKernels]
+  [pm_left_aux]
+    type = ParsedAux
+    variable = pm_left
+    coupled_variables = 'pm'
+    expression = 'if(x < 0, pm, 0)'
+    use_xyz = true
+    execute_on = 'TIMESTEP_END'
+  []
+  [pm_right_aux]
+    type = ParsedAux
+    variable = pm_right
+    coupled_variables = 'pm'
+    expression = 'if(x > 0, pm, 0)'
+    use_xyz = true
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+# The fault leaks symmetrically into the matrix on both sides of the split interface
+[Postprocessors]
+  [pm_l]
+    type = ElementIntegralVariablePostprocessor
+    variable = pm_left
+    block = 0
+    execute_on = 'TIMESTEP_END'
+  []
+  [pm_r]
+    type = ElementIntegralVariablePostprocessor
+    variable = pm_right
+    block = 0
+    execute_on = 'TIMESTEP_END'
+  []
+  [symmetric]
+    type = ParsedPostprocessor
+    expression = 'if(pm_r > 0 & abs(pm_l - pm_r) < 1e-04 * abs(pm_l + pm_r), 1, 0)'
+    pp_names = 'pm_l pm_r'
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[FVBCs]
+  [p_fault_bottom]
+    type = FVDirichletBC
+    variable = pf
+    boundary = bottom
+    value = 1.0e+06
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVSinglePhaseFlowMaterial
+  []
+  [matrix_permeability]
+    type = BVConstantPermeability
+    block = 0
+    permeability = 1.0e-18
+  []
+  [fault_permeability]
+    type = BVConstantPermeability
+    block = 'fault'
+    permeability = 1.0e-12
+  []
+  [fault_aperture]
+    type = BVConstantFaultAperture
+    block = 'fault'
+    aperture = 1.0e-03
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 0.1
+  []
+  [matrix_fluid_properties]
+    type = BVFluidProperties
+    block = 0
+    fluid_pressure = pm
+    temperature = 273
+    fp = simple_fluid
+  []
+  [fault_fluid_properties]
+    type = BVFluidProperties
+    block = 'fault'
+    fluid_pressure = pf
+    temperature = 273
+    fp = simple_fluid
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid]
+    type = SimpleFluidProperties
+    density0 = 1000.0
+    viscosity = 1.0e-03
+    bulk_modulus = 2.0e+09
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  automatic_scaling = true
+  start_time = 0.0
+  end_time = 3600
+  num_steps = 5
+[]
+
+[Outputs]
+  exodus = true
+  [csv]
+    type = CSV
+    file_base = 'fv_fault_flow_2D_out'
+    show = 'symmetric'
+    execute_on = 'FINAL'
+  []
+[]
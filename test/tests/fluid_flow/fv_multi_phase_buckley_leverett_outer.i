@@ -0,0 +1,257 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  xmin = 0
+  xmax = 1
+  nx = 10
+  ymin = -0.01
+  ymax = 0.01
+  zmin = -0.01
+  zmax = 0.01
+  ny = 1
+  nz = 1
+[]
+
+[Problem]
+  nl_sys_names = 'pressure saturation'
+[]
+
+[Variables]
+  [p]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+    solver_sys = pressure
+  []
+  [sw]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+    initial_condition = 0.05
+    solver_sys = saturation
+  []
+  [sn]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+    initial_condition = 0.95
+    solver_sys = saturation
+  []
+[]
+
+[AuxVariables]
+  [sw_coupled]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+[]
+
+[FVKernels]
+  # Total pressure
+  [darcy_p]
+    type = BVFVMultiPhasePressureDarcy
+    variable = p
+    lagged_mobility = lagged_mobility
+  []
+  # Wetting phase
+  [time_w]
+    type = BVFVMultiPhaseSaturationTimeDerivative
+    variable = sw
+    phase = 'wetting'
+  []
+  [darcy_w]
+    type = BVFVMultiPhaseSaturationDarcy
+    variable = sw
+    total_pressure = p
+    phase = 'wetting'
+    transport_scheme = implicit
+    lagged_mobility = lagged_mobility
+  []
+  # Non-wetting phase
+  [time_nw]
+    type = BVFVMultiPhaseSaturationTimeDerivative
+    variable = sn
+    phase = 'non_wetting'
+  []
+  [darcy_nw]
+    type = BVFVMultiPhaseSaturationDarcy
+    variable = sn
+    total_pressure = p
+    phase = 'non_wetting'
+    transport_scheme = implicit
+    lagged_mobility = lagged_mobility
+  []
+[]
+
+[UserObjects]
+  [lagged_mobility]
+    type = BVFVLaggedMobility
+  []
+[]
+
+[FVBCs]
+  [leftinflux_pw]
+    type = FVDirichletBC
+    variable = p
+    value = 1.0
+    boundary = 'left'
+  []
+  [right_pw]
+    type = FVDirichletBC
+    variable = p
+    value = 0.0
+    boundary = 'right'
+  []
+  [leftinflux_sw]
+    type = FVDirichletBC
+    variable = sw
+    value = 0.95
+    boundary = 'left'
+  []
+  [right_sw]
+    type = FVDirichletBC
+    variable = sw
+    value = 0.05
+    boundary = 'right'
+  []
+  [leftinflux_sn]
+    type = FVDirichletBC
+    variable = sn
+    value = 0.05
+    boundary = 'left'
+  []
+  [right_sn]
+    type = FVDirichletBC
+    variable = sn
+    value = 0.95
+    boundary = 'right'
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVMultiPhaseFlowMaterial
+    output_properties = 'fluid_mobility_w fluid_mobility_n'
+    outputs = exodus
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 1.0
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [fluid_properties_w]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_w
+    phase = 'wetting'
+  []
+  [fluid_properties_nw]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_nw
+    phase = 'non_wetting'
+  []
+  [capillary_pressure]
+    type = BVCapillaryPressurePowerLaw
+    saturation_w = sw
+    exponent = 2
+    reference_capillary_pressure = 1.0e-04
+    output_properties = 'capillary_pressure'
+    outputs = exodus
+  []
+  [rel_perm]
+    type = BVRelativePermeabilityPowerLaw
+    saturation_w = sw
+    exponent = 2
+    output_properties = 'relative_permeability_w relative_permeability_n'
+    outputs = exodus
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid_w]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+  [simple_fluid_nw]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+[]
+
+[MultiApps]
+  [coupled]
+    type = TransientMultiApp
+    input_files = 'fv_multi_phase_buckley_leverett.i'
+  []
+[]
+
+[Transfers]
+  [sw_coupled]
+    type = MultiAppCopyTransfer
+    from_multi_app = coupled
+    source_variable = sw
+    variable = sw_coupled
+  []
+[]
+
+[Postprocessors]
+  [sw_norm]
+    type = ElementL2Norm
+    variable = sw
+    outputs = none
+  []
+  [sw_error]
+    type = ElementL2Difference
+    variable = sw
+    other_variable = sw_coupled
+    outputs = none
+  []
+  [matches_coupled]
+    type = ParsedPostprocessor
+    expression = 'if(sw_error < 1e-05 * sw_norm, 1, 0)'
+    pp_names = 'sw_error sw_norm'
+  []
+[]
+
+[Convergence]
+  [outer]
+    type = IterationCountConvergence
+    min_iterations = 20
+    max_iterations = 20
+    converge_at_max_iterations = true
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0
+  end_time = 0.3
+  num_steps = 3
+  timestep_tolerance = 1.0e-05
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+  nl_abs_tol = 1.0e-10
+  multi_system_fixed_point = true
+  multi_system_fixed_point_convergence = outer
+  residual_and_jacobian_together = true
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  execute_on = 'INITIAL TIMESTEP_END'
+  exodus = true
+  [csv]
+    type = CSV
+    execute_on = 'FINAL'
+  []
+[]
@@ -0,0 +1,222 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 50
+  xmin = 0
+  xmax = 1
+[]
+
+[Variables]
+  [pf]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  [c1]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  [c2]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  [c]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+[]
+
+[ICs]
+  [pf_ic]
+    type = FunctionIC
+    variable = pf
+    function = '1-x'
+  []
+[]
+
+[FVKernels]
+  [darcy_p]
+    type = BVFVSinglePhaseDarcy
+    variable = pf
+  []
+  [time_derivative_c1]
+    type = BVFVSinglePhaseSoluteTimeDerivative
+    variable = c1
+  []
+  [darcy_c1]
+    type = BVFVMultiSpeciesSoluteDarcy
+    variable = c1
+    fluid_pressure = pf
+    species = 0
+  []
+  [time_derivative_c2]
+    type = BVFVSinglePhaseSoluteTimeDerivative
+    variable = c2
+  []
+  [darcy_c2]
+    type = BVFVMultiSpeciesSoluteDarcy
+    variable = c2
+    fluid_pressure = pf
+    species = 1
+  []
+  # Single species reference
+  [time_derivative_c]
+    type = BVFVSinglePhaseSoluteTimeDerivative
+    variable = c
+  []
+  [darcy_c]
+    type = BVFVSinglePhaseSoluteDarcy
+    variable = c
+    fluid_pressure = pf
+  []
+[]
+
+[UserObjects]
+  [darcy_flux]
+    type = BVFVDarcyFluxCache
+  []
+[]
+
+[FVBCs]
+  [p_left]
+    type = FVDirichletBC
+    variable = pf
+    boundary = 'left'
+    value = 1
+  []
+  [p_right]
+    type = FVDirichletBC
+    variable = pf
+    boundary = 'right'
+    value = 0
+  []
+  [c1_left]
+    type = FVDirichletBC
+    variable = c1
+    boundary = 'left'
+    value = 1
+  []
+  [c1_right]
+    type = FVDirichletBC
+    variable = c1
+    boundary = 'right'
+    value = 0
+  []
+  [c2_left]
+    type = FVDirichletBC
+    variable = c2
+    boundary = 'left'
+    value = 1
+  []
+  [c2_right]
+    type = FVDirichletBC
+    variable = c2
+    boundary = 'right'
+    value = 0
+  []
+  [c_left]
+    type = FVDirichletBC
+    variable = c
+    boundary = 'left'
+    value = 1
+  []
+  [c_right]
+    type = FVDirichletBC
+    variable = c
+    boundary = 'right'
+    value = 0
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVSinglePhaseFlowMaterial
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 1.0
+  []
+  [solute_mat]
+    type = BVSinglePhaseFlowSoluteMaterial
+  []
+  [dispersion]
+    type = BVConstantDispersion
+    dispersion = 1.0e-03
+    species_dispersion = '1.0e-03 1.0e-03'
+  []
+  [fluid_properties]
+    type = BVFluidProperties
+    fluid_pressure = pf
+    temperature = 273
+    fp = simple_fluid
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+[]
+
+[Postprocessors]
+  [c_norm]
+    type = ElementL2Norm
+    variable = c
+    outputs = none
+  []
+  [c1_error]
+    type = ElementL2Difference
+    variable = c1
+    other_variable = c
+    outputs = none
+  []
+  [c2_error]
+    type = ElementL2Difference
+    variable = c2
+    other_variable = c
+    outputs = none
+  []
+  [matches_single_species]
+    type = ParsedPostprocessor
+    expression = 'if(c1_error < 1e-06 * c_norm & c2_error < 1e-06 * c_norm, 1, 0)'
+    pp_names = 'c1_error c2_error c_norm'
+  []
+[]
+
+[Preconditioning]
+  [hypre]
+    type = SMP
+    full = true
+    petsc_options = '-snes_ksp_ew'
+    petsc_options_iname = '-snes_linesearch_type -pc_type -pc_hypre_type'
+    petsc_options_value = 'bt hypre boomeramg'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  automatic_scaling = true
+  residual_and_jacobian_together = true
+  start_time = 0
+  end_time = 0.3
+  num_steps = 3
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  exodus = true
+  [csv]
+    type = CSV
+    execute_on = 'FINAL'
+  []
+[]
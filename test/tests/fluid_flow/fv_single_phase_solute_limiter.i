@@ -0,0 +1,222 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 50
+  xmin = 0
+  xmax = 1
+[]
+
+[Variables]
+  [pf]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  [c]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+[]
+
+[ICs]
+  [pf_ic]
+    type = FunctionIC
+    variable = pf
+    function = '1-x'
+  []
+[]
+
+[AuxVariables]
+  [c_upwind]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  # Cells in the concentration front
+  [front]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [front_upwind]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [front_aux]
+    type = ParsedAux
+    variable = front
+    expression = 'if(c > 0.1 & c < 0.9, 1, 0)'
+    coupled_variables = 'c'
+  []
+  [front_upwind_aux]
+    type = ParsedAux
+    variable = front_upwind
+    expression = 'if(c_upwind > 0.1 & c_upwind < 0.9, 1, 0)'
+    coupled_variables = 'c_upwind'
+  []
+[]
+
+[FVKernels]
+  [darcy_p]
+    type = BVFVSinglePhaseDarcy
+    variable = pf
+  []
+  [time_derivative_c]
+    type = BVFVSinglePhaseSoluteTimeDerivative
+    variable = c
+  []
+  [darcy_c]
+    type = BVFVSinglePhaseSoluteDarcy
+    variable = c
+    fluid_pressure = pf
+    advection_limiter = minmod
+  []
+[]
+
+[FVBCs]
+  [p_left]
+    type = FVDirichletBC
+    variable = pf
+    boundary = 'left'
+    value = 1
+  []
+  [p_right]
+    type = FVDirichletBC
+    variable = pf
+    boundary = 'right'
+    value = 0
+  []
+  [c_left]
+    type = FVDirichletBC
+    variable = c
+    boundary = 'left'
+    value = 1
+  []
+  [c_right]
+    type = FVDirichletBC
+    variable = c
+    boundary = 'right'
+    value = 0
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVSinglePhaseFlowMaterial
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 1.0
+  []
+  [solute_mat]
+    type = BVSinglePhaseFlowSoluteMaterial
+  []
+  # Small physical dispersion: the front width is controlled by the numerical dispersion
+  [dispersion]
+    type = BVConstantDispersion
+    dispersion = 1.0e-06
+  []
+  [fluid_properties]
+    type = BVFluidProperties
+    fluid_pressure = pf
+    temperature = 273
+    fp = simple_fluid
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+[]
+
+# Same problem with the first order upwind scheme
+[MultiApps]
+  [upwind]
+    type = TransientMultiApp
+    input_files = 'fv_single_phase_solute_limiter.i'
+    cli_args = 'FVKernels/darcy_c/advection_limiter=upwind;MultiApps/inactive=upwind;Transfers/inactive=c_upwind;Outputs/inactive=csv'
+  []
+[]
+
+[Transfers]
+  [c_upwind]
+    type = MultiAppCopyTransfer
+    from_multi_app = upwind
+    source_variable = c
+    variable = c_upwind
+  []
+[]
+
+[Postprocessors]
+  [c_min]
+    type = ElementExtremeValue
+    variable = c
+    value_type = min
+    outputs = none
+  []
+  [c_max]
+    type = ElementExtremeValue
+    variable = c
+    value_type = max
+    outputs = none
+  []
+  [front_width]
+    type = ElementIntegralVariablePostprocessor
+    variable = front
+    outputs = none
+  []
+  [front_width_upwind]
+    type = ElementIntegralVariablePostprocessor
+    variable = front_upwind
+    outputs = none
+  []
+  # The limited concentration stays within the boundary values and its front is sharper
+  [bounded]
+    type = ParsedPostprocessor
+    expression = 'if(c_min >= -1e-08 & c_max <= 1 + 1e-08, 1, 0)'
+    pp_names = 'c_min c_max'
+  []
+  [sharper_front]
+    type = ParsedPostprocessor
+    expression = 'if(front_width < front_width_upwind, 1, 0)'
+    pp_names = 'front_width front_width_upwind'
+  []
+[]
+
+[Preconditioning]
+  [hypre]
+    type = SMP
+    full = true
+    petsc_options = '-snes_ksp_ew'
+    petsc_options_iname = '-snes_linesearch_type -pc_type -pc_hypre_type'
+    petsc_options_value = 'bt hypre boomeramg'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  automatic_scaling = true
+  residual_and_jacobian_together = true
+  start_time = 0
+  end_time = 0.3
+  dt = 0.01
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  [csv]
+    type = CSV
+    execute_on = 'FINAL'
+  []
+[]
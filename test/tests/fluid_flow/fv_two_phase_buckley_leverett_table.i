@@ -0,0 +1,229 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  xmin = 0
+  xmax = 1
+  nx = 10
+  ymin = -0.01
+  ymax = 0.01
+  zmin = -0.01
+  zmax = 0.01
+  ny = 1
+  nz = 1
+[]
+
+[Variables]
+  [p]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  [sw]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+    initial_condition = 0.05
+  []
+[]
+
+[AuxVariables]
+  [sw_power_law]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+[]
+
+[FVKernels]
+  # Total pressure
+  [darcy_p]
+    type = BVFVMultiPhasePressureDarcy
+    variable = p
+  []
+  # Wetting phase
+  [time_w]
+    type = BVFVMultiPhaseSaturationTimeDerivative
+    variable = sw
+    phase = 'wetting'
+  []
+  # Single saturation equation: the non-wetting saturation is 1 - sw
+  [darcy_w]
+    type = BVFVMultiPhaseSaturationDarcy
+    variable = sw
+    total_pressure = p
+    phase = 'wetting'
+  []
+[]
+
+[FVBCs]
+  [leftinflux_pw]
+    type = FVDirichletBC
+    variable = p
+    value = 1.0
+    boundary = 'left'
+  []
+  [right_pw]
+    type = FVDirichletBC
+    variable = p
+    value = 0.0
+    boundary = 'right'
+  []
+  [leftinflux_sw]
+    type = FVDirichletBC
+    variable = sw
+    value = 0.95
+    boundary = 'left'
+  []
+  [right_sw]
+    type = FVDirichletBC
+    variable = sw
+    value = 0.05
+    boundary = 'right'
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVMultiPhaseFlowMaterial
+    output_properties = 'fluid_mobility_w fluid_mobility_n'
+    outputs = exodus
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 1.0
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [fluid_properties_w]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_w
+    phase = 'wetting'
+  []
+  [fluid_properties_nw]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_nw
+    phase = 'non_wetting'
+  []
+  [capillary_pressure]
+    type = BVCapillaryPressureTable
+    saturation_w = sw
+    # pc = 1e-04 sw^-2 tabulated
+    saturation = '0.01 0.02 0.03 0.04 0.05 0.075 0.1 0.125 0.15 0.175 0.2 0.225 0.25 0.275 0.3
+                  0.325 0.35 0.375 0.4 0.425 0.45 0.475 0.5 0.525 0.55 0.575 0.6 0.625 0.65 0.675
+                  0.7 0.725 0.75 0.775 0.8 0.825 0.85 0.875 0.9 0.925 0.95 0.975 1'
+    capillary_pressure = '1.000000e+00 2.500000e-01 1.111111e-01 6.250000e-02 4.000000e-02
+                          1.777778e-02 1.000000e-02 6.400000e-03 4.444444e-03 3.265306e-03
+                          2.500000e-03 1.975309e-03 1.600000e-03 1.322314e-03 1.111111e-03
+                          9.467456e-04 8.163265e-04 7.111111e-04 6.250000e-04 5.536332e-04
+                          4.938272e-04 4.432133e-04 4.000000e-04 3.628118e-04 3.305785e-04
+                          3.024575e-04 2.777778e-04 2.560000e-04 2.366864e-04 2.194787e-04
+                          2.040816e-04 1.902497e-04 1.777778e-04 1.664932e-04 1.562500e-04
+                          1.469238e-04 1.384083e-04 1.306122e-04 1.234568e-04 1.168736e-04
+                          1.108033e-04 1.051940e-04 1.000000e-04'
+    output_properties = 'capillary_pressure'
+    outputs = exodus
+  []
+  [rel_perm]
+    type = BVRelativePermeabilityTable
+    saturation_w = sw
+    # kr_w = sw^2 and kr_n = (1 - sw)^2 tabulated
+    saturation = '0 0.05 0.1 0.15 0.2 0.25 0.3 0.35 0.4 0.45 0.5 0.55 0.6 0.65 0.7 0.75 0.8 0.85
+                  0.9 0.95 1'
+    relative_permeability_w = '0 0.0025 0.01 0.0225 0.04 0.0625 0.09 0.1225 0.16 0.2025 0.25 0.3025
+                               0.36 0.4225 0.49 0.5625 0.64 0.7225 0.81 0.9025 1'
+    relative_permeability_n = '1 0.9025 0.81 0.7225 0.64 0.5625 0.49 0.4225 0.36 0.3025 0.25 0.2025
+                               0.16 0.1225 0.09 0.0625 0.04 0.0225 0.01 0.0025 0'
+    output_properties = 'relative_permeability_w relative_permeability_n'
+    outputs = exodus
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid_w]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+  [simple_fluid_nw]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+[]
+
+# Same problem with the power law curves
+[MultiApps]
+  [power_law]
+    type = TransientMultiApp
+    input_files = 'fv_two_phase_buckley_leverett.i'
+    cli_args = 'MultiApps/inactive=two_variable;Transfers/inactive=sw_two_variable;Outputs/inactive=csv'
+  []
+[]
+
+[Transfers]
+  [sw_power_law]
+    type = MultiAppCopyTransfer
+    from_multi_app = power_law
+    source_variable = sw
+    variable = sw_power_law
+  []
+[]
+
+[Postprocessors]
+  [sw_norm]
+    type = ElementL2Norm
+    variable = sw
+    outputs = none
+  []
+  [sw_error]
+    type = ElementL2Difference
+    variable = sw
+    other_variable = sw_power_law
+    outputs = none
+  []
+  # Interpolation error of the tabulated curves only
+  [matches_power_law]
+    type = ParsedPostprocessor
+    expression = 'if(sw_error < 1e-03 * sw_norm, 1, 0)'
+    pp_names = 'sw_error sw_norm'
+  []
+[]
+
+[Preconditioning]
+  [hypre]
+    type = SMP
+    full = true
+    petsc_options = '-snes_ksp_ew -snes_converged_reason -ksp_converged_reason'
+    petsc_options_iname = '-pc_type -pc_hypre_type
+                           -snes_atol -snes_max_it -snes_linesearch_type'
+    petsc_options_value = 'hypre boomeramg
+                           1.0e-10 1000 basic'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0
+  end_time = 0.3
+  num_steps = 3
+  timestep_tolerance = 1.0e-05
+  automatic_scaling = true
+  residual_and_jacobian_together = true
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  execute_on = 'INITIAL TIMESTEP_END'
+  exodus = true
+  [csv]
+    type = CSV
+    execute_on = 'FINAL'
+  []
+[]
@@ -0,0 +1,253 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 3
+  xmin = 0
+  xmax = 1
+  nx = 100
+  ymin = -0.01
+  ymax = 0.01
+  zmin = -0.01
+  zmax = 0.01
+  ny = 1
+  nz = 1
+[]
+
+[Variables]
+  [p]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  [sw]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+    initial_condition = 0.05
+  []
+[]
+
+[AuxVariables]
+  [sw_upwind]
+    order = CONSTANT
+    family = MONOMIAL
+    fv = true
+  []
+  # Cells in the saturation front (between the initial and the shock saturations)
+  [front]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [front_upwind]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [front_aux]
+    type = ParsedAux
+    variable = front
+    expression = 'if(sw > 0.15 & sw < 0.6, 1, 0)'
+    coupled_variables = 'sw'
+  []
+  [front_upwind_aux]
+    type = ParsedAux
+    variable = front_upwind
+    expression = 'if(sw_upwind > 0.15 & sw_upwind < 0.6, 1, 0)'
+    coupled_variables = 'sw_upwind'
+  []
+[]
+
+[FVKernels]
+  # Total pressure
+  [darcy_p]
+    type = BVFVMultiPhasePressureDarcy
+    variable = p
+  []
+  # Wetting phase
+  [time_w]
+    type = BVFVMultiPhaseSaturationTimeDerivative
+    variable = sw
+    phase = 'wetting'
+  []
+  # Single saturation equation: the non-wetting saturation is 1 - sw
+  [darcy_w]
+    type = BVFVMultiPhaseSaturationDarcy
+    variable = sw
+    total_pressure = p
+    phase = 'wetting'
+    advection_limiter = vanleer
+  []
+[]
+
+[FVBCs]
+  [leftinflux_pw]
+    type = FVDirichletBC
+    variable = p
+    value = 1.0
+    boundary = 'left'
+  []
+  [right_pw]
+    type = FVDirichletBC
+    variable = p
+    value = 0.0
+    boundary = 'right'
+  []
+  [leftinflux_sw]
+    type = FVDirichletBC
+    variable = sw
+    value = 0.95
+    boundary = 'left'
+  []
+  [right_sw]
+    type = FVDirichletBC
+    variable = sw
+    value = 0.05
+    boundary = 'right'
+  []
+[]
+
+[Materials]
+  [fluid_flow_mat]
+    type = BVMultiPhaseFlowMaterial
+    output_properties = 'fluid_mobility_w fluid_mobility_n'
+    outputs = exodus
+  []
+  [porosity]
+    type = BVConstantPorosity
+    porosity = 1.0
+  []
+  [permeability]
+    type = BVConstantPermeability
+    permeability = 1.0
+  []
+  [fluid_properties_w]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_w
+    phase = 'wetting'
+  []
+  [fluid_properties_nw]
+    type = BVFluidProperties
+    fluid_pressure = p
+    temperature = 273
+    fp = simple_fluid_nw
+    phase = 'non_wetting'
+  []
+  [capillary_pressure]
+    type = BVCapillaryPressurePowerLaw
+    saturation_w = sw
+    exponent = 2
+    reference_capillary_pressure = 1.0e-04
+    output_properties = 'capillary_pressure'
+    outputs = exodus
+  []
+  [rel_perm]
+    type = BVRelativePermeabilityPowerLaw
+    saturation_w = sw
+    exponent = 2
+    output_properties = 'relative_permeability_w relative_permeability_n'
+    outputs = exodus
+  []
+[]
+
+[FluidProperties]
+  [simple_fluid_w]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+  [simple_fluid_nw]
+    type = SimpleFluidProperties
+    density0 = 1.0
+    viscosity = 1.0
+  []
+[]
+
+# Same problem with the first order upwind scheme
+[MultiApps]
+  [upwind]
+    type = TransientMultiApp
+    input_files = 'fv_two_phase_buckley_leverett_vanleer.i'
+    cli_args = 'FVKernels/darcy_w/advection_limiter=upwind;MultiApps/inactive=upwind;Transfers/inactive=sw_upwind;Outputs/inactive=csv'
+  []
+[]
+
+[Transfers]
+  [sw_upwind]
+    type = MultiAppCopyTransfer
+    from_multi_app = upwind
+    source_variable = sw
+    variable = sw_upwind
+  []
+[]
+
+[Postprocessors]
+  [sw_min]
+    type = ElementExtremeValue
+    variable = sw
+    value_type = min
+    outputs = none
+  []
+  [sw_max]
+    type = ElementExtremeValue
+    variable = sw
+    value_type = max
+    outputs = none
+  []
+  [front_width]
+    type = ElementIntegralVariablePostprocessor
+    variable = front
+    outputs = none
+  []
+  [front_width_upwind]
+    type = ElementIntegralVariablePostprocessor
+    variable = front_upwind
+    outputs = none
+  []
+  # The limited saturation stays within the physical bounds and its front is sharper
+  [bounded]
+    type = ParsedPostprocessor
+    expression = 'if(sw_min >= 0 & sw_max <= 1, 1, 0)'
+    pp_names = 'sw_min sw_max'
+  []
+  [sharper_front]
+    type = ParsedPostprocessor
+    expression = 'if(front_width < front_width_upwind, 1, 0)'
+    pp_names = 'front_width front_width_upwind'
+  []
+[]
+
+[Preconditioning]
+  [hypre]
+    type = SMP
+    full = true
+    petsc_options = '-snes_ksp_ew -snes_converged_reason -ksp_converged_reason'
+    petsc_options_iname = '-pc_type -pc_hypre_type
+                           -snes_atol -snes_max_it -snes_linesearch_type'
+    petsc_options_value = 'hypre boomeramg
+                           1.0e-10 1000 basic'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0
+  end_time = 0.3
+  dt = 0.01
+  timestep_tolerance = 1.0e-05
+  automatic_scaling = true
+  residual_and_jacobian_together = true
+[]
+
+[Outputs]
+  print_linear_residuals = false
+  execute_on = 'INITIAL TIMESTEP_END'
+  exodus = true
+  [csv]
+    type = CSV
+    execute_on = 'FINAL'
+  []
+[]
@@ -0,0 +1,233 @@
+[Mesh]
+  [file]
+    type = FileMeshGenerator
+    file = mesh-2D.msh
+  []
+  [fault_gen]
+    type = BVFaultInterfaceGenerator
+    input = file
+    sidesets = 'interface'
+  []
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+  []
+[]
+
+[Kernels]
+  [inertia_x]
+    type = BVInertia
+    variable = disp_x
+  []
+  [inertia_y]
+    type = BVInertia
+    variable = disp_y
+  []
+  [stress_x]
+    type = BVStressDivergence
+    component = x
+    variable = disp_x
+  []
+  [stress_y]
+    type = BVStressDivergence
+    component = y
+    variable = disp_y
+  []
+[]
+
+[InterfaceKernels]
+  [traction_x]
+    type = BVMechanicalInterface
+    boundary = 'interface'
+    component = x
+    variable = disp_x
+    neighbor_var = disp_x
+  []
+  [traction_y]
+    type = BVMechanicalInterface
+    boundary = 'interface'
+    component = y
+    variable = disp_y
+    neighbor_var = disp_y
+  []
+[]
+
+[AuxVariables]
+  [strain_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [normal_stress]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [shear_stress]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [strain_xy_aux]
+    type = BVStrainComponentAux
+    variable = strain_xy
+    index_i = x
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_xy_aux]
+    type = BVStressComponentAux
+    variable = stress_xy
+    index_i = x
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_yy_aux]
+    type = BVStressComponentAux
+    variable = stress_yy
+    index_i = y
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+  [normal_stress_aux]
+    type = BVFaultNormalStressAux
+    variable = normal_stress
+    boundary = 'interface'
+    execute_on = 'TIMESTEP_END'
+  []
+  [shear_stress_aux]
+    type = BVFaultShearStressAux
+    variable = shear_stress
+    boundary = 'interface'
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Functions]
+  [disp_x_func]
+    type = ParsedFunction
+    expression = 'm*t*y'
+    symbol_names = 'm'
+    symbol_values = '0.1'
+  []
+[]
+
+[BCs]
+  [Periodic]
+    [left_right]
+      auto_direction = x
+      # primary = 'left'
+      # secondary = 'right'
+      variable = 'disp_x disp_y'
+    []
+  []
+  [no_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom top'
+    value = 0.0
+  []
+  [disp_x_plate]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 'bottom top'
+    function = disp_x_func
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = BVMechanicalMaterial
+    displacements = 'disp_x disp_y'
+    young_modulus = 10.0
+    poisson_ratio = 0.25
+    density = 1.0
+    initial_stress = '0.0 1.6 0.0'
+  []
+  [interface]
+    type = BVMechanicalInterfaceMaterial
+    boundary = 'interface'
+    displacements = 'disp_x disp_y'
+    normal_stiffness = 100.0
+    tangent_stiffness = 100.0
+    friction_model = 'constant_friction'
+  []
+  [constant_friction]
+    type = BVConstantFrictionUpdate
+    friction = 0.5
+  []
+[]
+
+[Postprocessors]
+  [critical_dt]
+    type = BVCriticalTimeStep
+    interface_materials = 'interface'
+    factor = 0.5
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [max_disp_x]
+    type = NodalExtremeValue
+    variable = disp_x
+    value_type = max
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  [min_disp_x]
+    type = NodalExtremeValue
+    variable = disp_x
+    value_type = min
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  # Interface limited: 0.5 * 2 / sqrt(4 M / (rho h^2) + 4 k / (rho h)) with M = 12, k = 100 and
+  # h = 0.24613 the smallest edge of the elements along the interface
+  [dt_check]
+    type = ParsedPostprocessor
+    expression = 'if(abs(critical_dt - 0.0228241551477) < 1e-10, 1, 0)'
+    pp_names = 'critical_dt'
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+  # The displacement stays of the order of the imposed one (0.025 at the end)
+  [stable]
+    type = ParsedPostprocessor
+    expression = 'if(max(abs(max_disp_x), abs(min_disp_x)) < 0.05, 1, 0)'
+    pp_names = 'max_disp_x min_disp_x'
+    execute_on = 'INITIAL TIMESTEP_END'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  start_time = 0.0
+  end_time = 0.5
+  [TimeIntegrator]
+    type = CentralDifference
+    solve_type = lumped
+  []
+  [TimeStepper]
+    type = PostprocessorDT
+    postprocessor = critical_dt
+  []
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    file_base = 'explicit_dynamics_2D_out'
+    show = 'dt_check stable'
+    execute_on = 'FINAL'
+  []
+[]
@@ -0,0 +1,92 @@
+# A circular fault (r = 1) splits a half annulus into an inner and an outer part. Without an
+# interface kernel, the two parts are disconnected: the diffusion solution is 1 inside and 0
+# outside. The 13 nodes of the fault are duplicated (104 nodes instead of 91).
+
+[Mesh]
+  [gen]
+    type = AnnularMeshGenerator
+    nr = 6
+    nt = 12
+    rmin = 0.5
+    rmax = 2.0
+    dmin = 0.0
+    dmax = 180.0
+  []
+  [inner]
+    type = ParsedSubdomainMeshGenerator
+    input = gen
+    combinatorial_geometry = 'x * x + y * y < 1'
+    block_id = 1
+  []
+  [fault]
+    type = SideSetsBetweenSubdomainsGenerator
+    input = inner
+    primary_block = 1
+    paired_block = 0
+    new_boundary = 'fault'
+  []
+  [interface_gen]
+    type = BVFaultInterfaceGenerator
+    input = fault
+    sidesets = 'fault'
+  []
+[]
+
+[Variables]
+  [u]
+  []
+[]
+
+[Kernels]
+  [diffusion]
+    type = Diffusion
+    variable = u
+  []
+[]
+
+[BCs]
+  [inside]
+    type = DirichletBC
+    variable = u
+    boundary = 'rmin'
+    value = 1.0
+  []
+  [outside]
+    type = DirichletBC
+    variable = u
+    boundary = 'rmax'
+    value = 0.0
+  []
+[]
+
+[Postprocessors]
+  [num_nodes]
+    type = NumNodes
+  []
+  [u_inner]
+    type = ElementAverageValue
+    variable = u
+    block = 1
+  []
+  [u_outer]
+    type = ElementAverageValue
+    variable = u
+    block = 0
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1.0
+  solve_type = 'NEWTON'
+  nl_rel_tol = 1.0e-12
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    file_base = 'fault_interface_curved_out'
+    execute_on = 'FINAL'
+  []
+[]
@@ -0,0 +1,122 @@
+# Two faults crossing at the origin split the square into four quadrants. Without an interface
+# kernel, the quadrants are disconnected: the diffusion solution is 1 in the left quadrants and 0
+# in the right ones. The crossing node has four copies (36 nodes instead of 25).
+
+[Mesh]
+  [gen]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 4
+    ny = 4
+    xmin = -1
+    xmax = 1
+    ymin = -1
+    ymax = 1
+  []
+  [top_right]
+    type = ParsedSubdomainMeshGenerator
+    input = gen
+    combinatorial_geometry = 'x > 0 & y > 0'
+    block_id = 1
+  []
+  [bottom_left]
+    type = ParsedSubdomainMeshGenerator
+    input = top_right
+    combinatorial_geometry = 'x < 0 & y < 0'
+    block_id = 2
+  []
+  [bottom_right]
+    type = ParsedSubdomainMeshGenerator
+    input = bottom_left
+    combinatorial_geometry = 'x > 0 & y < 0'
+    block_id = 3
+  []
+  [horizontal]
+    type = SideSetsBetweenSubdomainsGenerator
+    input = bottom_right
+    primary_block = '0 1'
+    paired_block = '2 3'
+    new_boundary = 'horizontal'
+  []
+  [vertical]
+    type = SideSetsBetweenSubdomainsGenerator
+    input = horizontal
+    primary_block = '0 2'
+    paired_block = '1 3'
+    new_boundary = 'vertical'
+  []
+  [interface_gen]
+    type = BVFaultInterfaceGenerator
+    input = vertical
+    sidesets = 'horizontal vertical'
+  []
+[]
+
+[Variables]
+  [u]
+  []
+[]
+
+[Kernels]
+  [diffusion]
+    type = Diffusion
+    variable = u
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = u
+    boundary = 'left'
+    value = 1.0
+  []
+  [right]
+    type = DirichletBC
+    variable = u
+    boundary = 'right'
+    value = 0.0
+  []
+[]
+
+[Postprocessors]
+  [num_nodes]
+    type = NumNodes
+  []
+  [u_top_left]
+    type = ElementAverageValue
+    variable = u
+    block = 0
+  []
+  [u_top_right]
+    type = ElementAverageValue
+    variable = u
+    block = 1
+  []
+  [u_bottom_left]
+    type = ElementAverageValue
+    variable = u
+    block = 2
+  []
+  [u_bottom_right]
+    type = ElementAverageValue
+    variable = u
+    block = 3
+  []
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  dt = 1.0
+  solve_type = 'NEWTON'
+  nl_rel_tol = 1.0e-12
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    file_base = 'fault_interface_intersection_out'
+    execute_on = 'FINAL'
+  []
+[]
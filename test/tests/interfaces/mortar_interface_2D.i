@@ -0,0 +1,231 @@
+[Mesh]
+  [bottom]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 4
+    ny = 2
+    xmin = 0
+    xmax = 1
+    ymin = -1
+    ymax = 0
+    boundary_name_prefix = 'bottom'
+  []
+  [bottom_block]
+    type = SubdomainIDGenerator
+    input = bottom
+    subdomain_id = 1
+  []
+  [top]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 5
+    ny = 2
+    xmin = 0
+    xmax = 1
+    ymin = 0
+    ymax = 1
+    boundary_name_prefix = 'top'
+    boundary_id_offset = 10
+  []
+  [top_block]
+    type = SubdomainIDGenerator
+    input = top
+    subdomain_id = 2
+  []
+  [combined]
+    type = MeshCollectionGenerator
+    inputs = 'bottom_block top_block'
+  []
+  [secondary]
+    type = LowerDBlockFromSidesetGenerator
+    input = combined
+    sidesets = 'bottom_top'
+    new_block_id = 11
+    new_block_name = 'secondary_lower'
+  []
+  [primary]
+    type = LowerDBlockFromSidesetGenerator
+    input = secondary
+    sidesets = 'top_bottom'
+    new_block_id = 12
+    new_block_name = 'primary_lower'
+  []
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  []
+[]
+
+[AuxVariables]
+  [stress_xy]
+    order = CONSTANT
+    family = MONOMIAL
+    block = '1 2'
+  []
+[]
+
+[Kernels]
+  [stress_x]
+    type = BVStressDivergence
+    component = x
+    variable = disp_x
+    block = '1 2'
+  []
+  [stress_y]
+    type = BVStressDivergence
+    component = y
+    variable = disp_y
+    block = '1 2'
+  []
+[]
+
+[Constraints]
+  [traction_x]
+    type = BVMortarMechanicalInterface
+    component = x
+    displacements = 'disp_x disp_y'
+    primary_variable = disp_x
+    secondary_variable = disp_x
+    primary_boundary = 'top_bottom'
+    secondary_boundary = 'bottom_top'
+    primary_subdomain = 'primary_lower'
+    secondary_subdomain = 'secondary_lower'
+    normal_stiffness = 1.0e+03
+    tangent_stiffness = 1.0e+03
+    friction = 0.5
+  []
+  [traction_y]
+    type = BVMortarMechanicalInterface
+    component = y
+    displacements = 'disp_x disp_y'
+    primary_variable = disp_y
+    secondary_variable = disp_y
+    primary_boundary = 'top_bottom'
+    secondary_boundary = 'bottom_top'
+    primary_subdomain = 'primary_lower'
+    secondary_subdomain = 'secondary_lower'
+    normal_stiffness = 1.0e+03
+    tangent_stiffness = 1.0e+03
+    friction = 0.5
+  []
+[]
+
+[AuxKernels]
+  [stress_xy_aux]
+    type = BVStressComponentAux
+    variable = stress_xy
+    index_i = x
+    index_j = y
+    block = '1 2'
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Functions]
+  [disp_x_func]
+    type = ParsedFunction
+    expression = '0.1*t'
+  []
+[]
+
+[BCs]
+  [fix_x_bottom]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'bottom_bottom'
+    value = 0.0
+  []
+  [fix_y_bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom_bottom'
+    value = 0.0
+  []
+  [disp_x_top]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 'top_top'
+    function = disp_x_func
+  []
+  [fix_y_top]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'top_top'
+    value = 0.0
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = BVMechanicalMaterial
+    block = '1 2'
+    displacements = 'disp_x disp_y'
+    young_modulus = 10.0
+    poisson_ratio = 0.25
+    initial_stress = '0.0 1.6 0.0'
+  []
+[]
+
+[Postprocessors]
+  [disp_top]
+    type = SideAverageValue
+    variable = disp_x
+    boundary = 'top_bottom'
+    outputs = none
+  []
+  [disp_bottom]
+    type = SideAverageValue
+    variable = disp_x
+    boundary = 'bottom_top'
+    outputs = none
+  []
+  [slip]
+    type = ParsedPostprocessor
+    expression = 'disp_top - disp_bottom'
+    pp_names = 'disp_top disp_bottom'
+  []
+  [max_shear]
+    type = ElementExtremeValue
+    variable = stress_xy
+    value_type = max
+    block = '1 2'
+    outputs = none
+  []
+  [min_shear]
+    type = ElementExtremeValue
+    variable = stress_xy
+    value_type = min
+    block = '1 2'
+    outputs = none
+  []
+  [traction_check]
+    type = ParsedPostprocessor
+    expression = 'if(abs(max_shear) < 1e-06 & abs(min_shear) < 1e-06, 1, 0)'
+    pp_names = 'max_shear min_shear'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0.0
+  end_time = 4.0
+  dt = 1.0
+[]
+
+[Outputs]
+  exodus = true
+  [csv]
+    type = CSV
+    execute_on = 'FINAL'
+  []
+[]
@@ -0,0 +1,233 @@
+[Mesh]
+  [bottom]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 4
+    ny = 2
+    xmin = 0
+    xmax = 1
+    ymin = -1
+    ymax = 0
+    boundary_name_prefix = 'bottom'
+  []
+  [bottom_block]
+    type = SubdomainIDGenerator
+    input = bottom
+    subdomain_id = 1
+  []
+  [top]
+    type = GeneratedMeshGenerator
+    dim = 2
+    nx = 5
+    ny = 2
+    xmin = 0
+    xmax = 1
+    ymin = 0
+    ymax = 1
+    boundary_name_prefix = 'top'
+    boundary_id_offset = 10
+  []
+  [top_block]
+    type = SubdomainIDGenerator
+    input = top
+    subdomain_id = 2
+  []
+  [combined]
+    type = MeshCollectionGenerator
+    inputs = 'bottom_block top_block'
+  []
+  [secondary]
+    type = LowerDBlockFromSidesetGenerator
+    input = combined
+    sidesets = 'bottom_top'
+    new_block_id = 11
+    new_block_name = 'secondary_lower'
+  []
+  [primary]
+    type = LowerDBlockFromSidesetGenerator
+    input = secondary
+    sidesets = 'top_bottom'
+    new_block_id = 12
+    new_block_name = 'primary_lower'
+  []
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+    block = '1 2'
+  []
+[]
+
+[AuxVariables]
+  [stress_xy]
+    order = CONSTANT
+    family = MONOMIAL
+    block = '1 2'
+  []
+[]
+
+[Kernels]
+  [stress_x]
+    type = BVStressDivergence
+    component = x
+    variable = disp_x
+    block = '1 2'
+  []
+  [stress_y]
+    type = BVStressDivergence
+    component = y
+    variable = disp_y
+    block = '1 2'
+  []
+[]
+
+[Constraints]
+  [traction_x]
+    type = BVMortarMechanicalInterface
+    component = x
+    displacements = 'disp_x disp_y'
+    primary_variable = disp_x
+    secondary_variable = disp_x
+    primary_boundary = 'top_bottom'
+    secondary_boundary = 'bottom_top'
+    primary_subdomain = 'primary_lower'
+    secondary_subdomain = 'secondary_lower'
+    normal_stiffness = 1.0e+03
+    tangent_stiffness = 1.0e+03
+    friction = 0.5
+  []
+  [traction_y]
+    type = BVMortarMechanicalInterface
+    component = y
+    displacements = 'disp_x disp_y'
+    primary_variable = disp_y
+    secondary_variable = disp_y
+    primary_boundary = 'top_bottom'
+    secondary_boundary = 'bottom_top'
+    primary_subdomain = 'primary_lower'
+    secondary_subdomain = 'secondary_lower'
+    normal_stiffness = 1.0e+03
+    tangent_stiffness = 1.0e+03
+    friction = 0.5
+  []
+[]
+
+[AuxKernels]
+  [stress_xy_aux]
+    type = BVStressComponentAux
+    variable = stress_xy
+    index_i = x
+    index_j = y
+    block = '1 2'
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Functions]
+  [disp_x_func]
+    type = ParsedFunction
+    expression = '0.1*t'
+  []
+[]
+
+[BCs]
+  # Each block is periodic in x so that the stress is uniform
+  [Periodic]
+    [bottom_x]
+      primary = 'bottom_left'
+      secondary = 'bottom_right'
+      translation = '1 0 0'
+      variable = 'disp_x disp_y'
+    []
+    [top_x]
+      primary = 'top_left'
+      secondary = 'top_right'
+      translation = '1 0 0'
+      variable = 'disp_x disp_y'
+    []
+  []
+  [fix_x_bottom]
+    type = DirichletBC
+    variable = disp_x
+    boundary = 'bottom_bottom'
+    value = 0.0
+  []
+  [fix_y_bottom]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom_bottom'
+    value = 0.0
+  []
+  [disp_x_top]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 'top_top'
+    function = disp_x_func
+  []
+  # Compressive normal load: sigma_n = -1
+  [load_y_top]
+    type = NeumannBC
+    variable = disp_y
+    boundary = 'top_top'
+    value = -1.0
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = BVMechanicalMaterial
+    block = '1 2'
+    displacements = 'disp_x disp_y'
+    young_modulus = 10.0
+    poisson_ratio = 0.25
+  []
+[]
+
+[Postprocessors]
+  [disp_bottom]
+    type = SideAverageValue
+    variable = disp_x
+    boundary = 'bottom_top'
+    outputs = none
+  []
+  [shear]
+    type = ElementAverageValue
+    variable = stress_xy
+    block = '1 2'
+    outputs = none
+  []
+  # The interface sticks until the shear traction reaches f |sigma_n| = 0.5 (t = 2.505) and then
+  # slides: the shear traction is 0.5 and the bottom block (G = 4, height 1) is sheared by 0.125
+  [shear_check]
+    type = ParsedPostprocessor
+    expression = 'if(abs(abs(shear) - 0.5) < 1e-06, 1, 0)'
+    pp_names = 'shear'
+  []
+  [disp_bottom_check]
+    type = ParsedPostprocessor
+    expression = 'if(abs(disp_bottom - 0.125) < 1e-06, 1, 0)'
+    pp_names = 'disp_bottom'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0.0
+  end_time = 4.0
+  dt = 1.0
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = 'FINAL'
+  []
+[]
@@ -0,0 +1,262 @@
+[Mesh]
+  [file]
+    type = FileMeshGenerator
+    file = mesh-2D.msh
+  []
+  [fault_gen]
+    type = BVFaultInterfaceGenerator
+    input = file
+    sidesets = 'interface'
+  []
+[]
+
+[Variables]
+  [disp_x]
+    order = FIRST
+    family = LAGRANGE
+  []
+  [disp_y]
+    order = FIRST
+    family = LAGRANGE
+  []
+[]
+
+[Kernels]
+  [stress_x]
+    type = BVStressDivergence
+    component = x
+    variable = disp_x
+  []
+  [stress_y]
+    type = BVStressDivergence
+    component = y
+    variable = disp_y
+  []
+[]
+
+[InterfaceKernels]
+  [traction_x]
+    type = BVMechanicalInterface
+    boundary = 'interface'
+    component = x
+    variable = disp_x
+    neighbor_var = disp_x
+  []
+  [traction_y]
+    type = BVMechanicalInterface
+    boundary = 'interface'
+    component = y
+    variable = disp_y
+    neighbor_var = disp_y
+  []
+[]
+
+[AuxVariables]
+  [strain_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_xy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [stress_yy]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [normal_stress]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [shear_stress]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [strain_xy_aux]
+    type = BVStrainComponentAux
+    variable = strain_xy
+    index_i = x
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_xy_aux]
+    type = BVStressComponentAux
+    variable = stress_xy
+    index_i = x
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+  [stress_yy_aux]
+    type = BVStressComponentAux
+    variable = stress_yy
+    index_i = y
+    index_j = y
+    execute_on = 'TIMESTEP_END'
+  []
+  [normal_stress_aux]
+    type = BVFaultNormalStressAux
+    variable = normal_stress
+    boundary = 'interface'
+    execute_on = 'TIMESTEP_END'
+  []
+  [shear_stress_aux]
+    type = BVFaultShearStressAux
+    variable = shear_stress
+    boundary = 'interface'
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Functions]
+  [disp_x_func]
+    type = ParsedFunction
+    expression = 'm*t*y'
+    symbol_names = 'm'
+    symbol_values = '0.1'
+  []
+[]
+
+[BCs]
+  [Periodic]
+    [left_right]
+      auto_direction = x
+      # primary = 'left'
+      # secondary = 'right'
+      variable = 'disp_x disp_y'
+    []
+  []
+  [no_y]
+    type = DirichletBC
+    variable = disp_y
+    boundary = 'bottom top'
+    value = 0.0
+  []
+  [disp_x_plate]
+    type = FunctionDirichletBC
+    variable = disp_x
+    boundary = 'bottom top'
+    function = disp_x_func
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = BVMechanicalMaterial
+    displacements = 'disp_x disp_y'
+    young_modulus = 10.0
+    poisson_ratio = 0.25
+    initial_stress = '0.0 1.6 0.0'
+  []
+  [interface]
+    type = BVMechanicalInterfaceMaterial
+    boundary = 'interface'
+    displacements = 'disp_x disp_y'
+    normal_stiffness = 1.0e+03
+    tangent_stiffness = 1.0e+03
+    friction_model = 'rate_state_friction'
+  []
+  [rate_state_friction]
+    type = BVRateStateFrictionUpdate
+    a = 0.015
+    b = 0.01
+    critical_slip_distance = 1.0e-02
+    reference_slip_rate = 1.0e-03
+    reference_friction = 0.5
+    state_law = aging
+  []
+[]
+
+# [Preconditioning]
+#   [hypre]
+#     type = SMP
+#     full = true
+#     petsc_options_iname = '-pc_type -pc_hypre_type'
+#     petsc_options_value = 'hypre boomeramg'
+#   []
+# []
+
+[Preconditioning]
+  [asm]
+    type = SMP
+    petsc_options = '-snes_ksp_ew'
+    petsc_options_iname = '-ksp_type -ksp_rtol -ksp_max_it
+                           -pc_type
+                           -sub_pc_type
+                           -snes_type -snes_atol -snes_rtol -snes_max_it -snes_linesearch_type
+                           -ksp_gmres_restart'
+    petsc_options_value = 'fgmres 1e-10 100
+                           asm
+                           ilu
+                           newtonls 1e-12 1e-08 100 basic
+                           201'
+  []
+[]
+
+[Postprocessors]
+  [max_slip_rate]
+    type = BVMaxSlipRate
+    boundary = 'interface'
+    execute_on = 'TIMESTEP_END'
+  []
+  [average_state]
+    type = BVAverageFrictionState
+    boundary = 'interface'
+    execute_on = 'TIMESTEP_END'
+  []
+  [shear_stress]
+    type = ElementAverageValue
+    variable = stress_xy
+    execute_on = 'TIMESTEP_END'
+  []
+  # Steady sliding at V = 0.1: tau = sigma_n f_ss(V) + eta V, where the fault normal traction
+  # sigma_n vanishes since the normal displacements are fixed. The radiation damping
+  # eta = G / (2 c_s) is 0 by default.
+  [shear_stress_check]
+    type = ParsedPostprocessor
+    expression = 'if(abs(abs(shear_stress) - eta * 0.1) < 1e-04, 1, 0)'
+    pp_names = 'shear_stress'
+    constant_names = 'eta'
+    constant_expressions = '0.0'
+    execute_on = 'TIMESTEP_END'
+  []
+  # Velocity strengthening: steady sliding at the loading rate V = 0.1 with theta = Dc / V
+  [slip_rate_check]
+    type = ParsedPostprocessor
+    expression = 'if(abs(max_slip_rate / 0.1 - 1.0) < 1e-03, 1, 0)'
+    pp_names = 'max_slip_rate'
+    execute_on = 'TIMESTEP_END'
+  []
+  [state_check]
+    type = ParsedPostprocessor
+    expression = 'if(abs(average_state / 0.1 - 1.0) < 1e-03, 1, 0)'
+    pp_names = 'average_state'
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = 'NEWTON'
+  start_time = 0.0
+  end_time = 10.0
+  [TimeStepper]
+    type = BVSlipRateTimeStepper
+    slip_rate = max_slip_rate
+    slip_increment = 2.0e-02
+    dt = 0.1
+    dt_min = 1.0e-04
+    dt_max = 1.0
+  []
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    file_base = 'rate_state_friction_2D_out'
+    show = 'shear_stress_check slip_rate_check state_check'
+    execute_on = 'FINAL'
+  []
+[]
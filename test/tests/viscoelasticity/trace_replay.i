@@ -0,0 +1,165 @@
+# Replays the 8 quadrature points of the elements 0 and 127 recorded in trace_record.i
+# Element 8 is deleted so that the element ids of the replay mesh are not contiguous: the
+# elements 0-7 replay the element 0 and the elements 9-16 replay the element 127
+[Mesh]
+  allow_renumbering = false
+  [mesh]
+    type = GeneratedMeshGenerator
+    dim = 3
+    nx = 17
+    ny = 1
+    nz = 1
+    xmin = 0
+    xmax = 17
+  []
+  [elem_0]
+    type = SubdomainBoundingBoxGenerator
+    input = mesh
+    block_id = 1
+    bottom_left = '-1 -1 -1'
+    top_right = '8 2 2'
+  []
+  [elem_127]
+    type = SubdomainBoundingBoxGenerator
+    input = elem_0
+    block_id = 2
+    bottom_left = '9 -1 -1'
+    top_right = '18 2 2'
+  []
+  [gap]
+    type = SubdomainBoundingBoxGenerator
+    input = elem_127
+    block_id = 3
+    bottom_left = '8 -1 -1'
+    top_right = '9 2 2'
+  []
+  [delete]
+    type = BlockDeletionGenerator
+    input = gap
+    block = 3
+  []
+[]
+
+[Problem]
+  solve = false
+[]
+
+[AuxVariables]
+  [disp_x]
+  []
+  [disp_y]
+  []
+  [disp_z]
+  []
+  [eqv_stress]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+  [Kelvin_creep_strain]
+    order = CONSTANT
+    family = MONOMIAL
+  []
+[]
+
+[AuxKernels]
+  [eqv_stress_aux]
+    type = BVMisesStressAux
+    variable = eqv_stress
+    execute_on = 'TIMESTEP_END'
+  []
+  [Kelvin_creep_strain_aux]
+    type = ADMaterialRealAux
+    variable = Kelvin_creep_strain
+    property = eqv_Kelvin_creep_strain
+    execute_on = 'TIMESTEP_END'
+  []
+[]
+
+[Materials]
+  [elasticity]
+    type = BVTraceReplayMaterial
+    displacements = 'disp_x disp_y disp_z'
+    bulk_modulus = 1.0
+    shear_modulus = 1.0
+    inelastic_models = 'viscoelastic'
+    replay_files = 'burger_trace.bin'
+  []
+  [viscoelastic]
+    type = BVBurgerModelUpdate
+    viscosity_maxwell = 10.0
+    viscosity_kelvin = 1.0
+    shear_modulus_kelvin = 1.0
+  []
+[]
+
+[VectorPostprocessors]
+  [recorded]
+    type = CSVReader
+    csv_file = 'trace_record_out.csv'
+    execute_on = 'INITIAL'
+    outputs = none
+  []
+[]
+
+[Postprocessors]
+  # Replayed averages
+  [eqv_stress_0]
+    type = ElementAverageValue
+    variable = eqv_stress
+    block = 1
+    outputs = none
+  []
+  [eqv_stress_127]
+    type = ElementAverageValue
+    variable = eqv_stress
+    block = 2
+    outputs = none
+  []
+  # Recorded averages at the final time
+  [recorded_eqv_stress_0]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = recorded
+    vector_name = eqv_stress_0
+    index = 10
+    outputs = none
+  []
+  [recorded_eqv_stress_127]
+    type = VectorPostprocessorComponent
+    vectorpostprocessor = recorded
+    vector_name = eqv_stress_127
+    index = 10
+    outputs = none
+  []
+  [error_0]
+    type = ParsedPostprocessor
+    expression = 'abs(eqv_stress_0 - recorded_eqv_stress_0)'
+    pp_names = 'eqv_stress_0 recorded_eqv_stress_0'
+  []
+  [error_127]
+    type = ParsedPostprocessor
+    expression = 'abs(eqv_stress_127 - recorded_eqv_stress_127)'
+    pp_names = 'eqv_stress_127 recorded_eqv_stress_127'
+  []
+[]
+
+[Executioner]
+  type = Transient
+  start_time = 0.0
+  end_time = 1.0
+  [Quadrature]
+    type = GAUSS
+    order = CONSTANT
+  []
+  [TimeStepper]
+    type = BVTraceTimeStepper
+    replay_files = 'burger_trace.bin'
+  []
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    file_base = 'trace_replay_out'
+    execute_on = 'FINAL'
+  []
+[]